@@ -0,0 +1,66 @@
+/***************************************************************************//**
+ * @file
+ * @brief Configuration file for the SL_ML_FFT real FFT.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+#ifndef SL_ML_FFT_CONFIG_H
+#define SL_ML_FFT_CONFIG_H
+
+/*******************************************************************************
+ ******************************   DEFINES   ************************************
+ ******************************************************************************/
+
+// <o SL_ML_FFT_MAX_LENGTH> Maximum FFT length
+// <i> Longest real FFT that can be initialized. The coefficient tables of
+// <i> this length are stored in flash, and shared by all the shorter FFTs.
+// <i> Lengths up to 2048 use generated tables of 4 bytes per point, the 4096
+// <i> and 8192 point lengths use the 32 KB tables of the CMSIS DSP library.
+// <i> The default matches the 512 point FFT of the audio frontend with a
+// <i> 30 ms window at 16 kHz. Projects using longer windows or other FFTs
+// <i> must raise it, longer FFTs fail to initialize.
+// <256=> 256
+// <512=> 512
+// <1024=> 1024
+// <2048=> 2048
+// <4096=> 4096
+// <8192=> 8192
+// <i> Default: 512
+#define SL_ML_FFT_MAX_LENGTH                       (512)
+
+// <q SL_ML_FFT_TABLES_IN_RAM> Copy coefficient tables to RAM
+// <i> If this is enabled, every FFT instance keeps a copy of the coefficients
+// <i> it uses in RAM, which avoids flash wait states during the FFT at the
+// <i> cost of 4 bytes of heap per point.
+// <i> Default: 0
+#define SL_ML_FFT_TABLES_IN_RAM                    (0)
+
+#endif // SL_ML_FFT_CONFIG_H
+
+// <<< end of configuration section >>>
@@ -72,6 +72,12 @@ float SL_TFLITE_MODEL_FE_ACTIVITY_DETECTION_ARM_THRESHOLD;
 float SL_TFLITE_MODEL_FE_ACTIVITY_DETECTION_TRIP_THRESHOLD;
 int   SL_TFLITE_MODEL_FE_DC_NOTCH_FILTER_ENABLE;
 float SL_TFLITE_MODEL_FE_DC_NOTCH_FILTER_COEFFICIENT;
+int   SL_TFLITE_MODEL_FE_DCT_ENABLE;
+int   SL_TFLITE_MODEL_FE_DCT_N_COEFFICIENTS;
+int   SL_TFLITE_MODEL_FE_ENERGY_GATE_ENABLE;
+float SL_TFLITE_MODEL_FE_ENERGY_GATE_THRESHOLD_RATIO;
+float SL_TFLITE_MODEL_FE_ENERGY_GATE_MIN_ENERGY;
+int   SL_TFLITE_MODEL_FE_ENERGY_GATE_HANGOVER_FRAMES;
 int   SL_TFLITE_MODEL_FE_QUANTIZE_DYNAMIC_SCALE_ENABLE;
 float SL_TFLITE_MODEL_FE_QUANTIZE_DYNAMIC_SCALE_RANGE_DB;
 float SL_TFLITE_MODEL_SAMPLEWISE_NORM_RESCALE;
@@ -115,6 +121,12 @@ bool sl_ml_audio_feature_generation_load_model_settings(const void* tflite_flatb
     GET_FLOAT_DEFAULT("fe.activity_detection_trip_threshold", SL_TFLITE_MODEL_FE_ACTIVITY_DETECTION_TRIP_THRESHOLD, 0.f);
     GET_INT_DEFAULT("fe.dc_notch_filter_enable", SL_TFLITE_MODEL_FE_DC_NOTCH_FILTER_ENABLE, 0);
     GET_FLOAT_DEFAULT("fe.dc_notch_filter_coefficient", SL_TFLITE_MODEL_FE_DC_NOTCH_FILTER_COEFFICIENT, 0.f);
+    GET_INT_DEFAULT("fe.dct_enable", SL_TFLITE_MODEL_FE_DCT_ENABLE, 0);
+    GET_INT_DEFAULT("fe.dct_n_coefficients", SL_TFLITE_MODEL_FE_DCT_N_COEFFICIENTS, 13);
+    GET_INT_DEFAULT("fe.energy_gate_enable", SL_TFLITE_MODEL_FE_ENERGY_GATE_ENABLE, 0);
+    GET_FLOAT_DEFAULT("fe.energy_gate_threshold_ratio", SL_TFLITE_MODEL_FE_ENERGY_GATE_THRESHOLD_RATIO, 4.f);
+    GET_FLOAT_DEFAULT("fe.energy_gate_min_energy", SL_TFLITE_MODEL_FE_ENERGY_GATE_MIN_ENERGY, 16.f);
+    GET_INT_DEFAULT("fe.energy_gate_hangover_frames", SL_TFLITE_MODEL_FE_ENERGY_GATE_HANGOVER_FRAMES, 10);
 
     GET_INT_DEFAULT("fe.quantize_dynamic_scale_enable", SL_TFLITE_MODEL_FE_QUANTIZE_DYNAMIC_SCALE_ENABLE, 0);
     GET_FLOAT_DEFAULT("fe.quantize_dynamic_scale_range_db", SL_TFLITE_MODEL_FE_QUANTIZE_DYNAMIC_SCALE_RANGE_DB, 0.f);
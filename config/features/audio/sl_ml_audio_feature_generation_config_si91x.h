@@ -67,6 +67,12 @@ extern float SL_TFLITE_MODEL_FE_ACTIVITY_DETECTION_ARM_THRESHOLD;
 extern float SL_TFLITE_MODEL_FE_ACTIVITY_DETECTION_TRIP_THRESHOLD;
 extern int   SL_TFLITE_MODEL_FE_DC_NOTCH_FILTER_ENABLE;
 extern float SL_TFLITE_MODEL_FE_DC_NOTCH_FILTER_COEFFICIENT;
+extern int   SL_TFLITE_MODEL_FE_DCT_ENABLE;
+extern int   SL_TFLITE_MODEL_FE_DCT_N_COEFFICIENTS;
+extern int   SL_TFLITE_MODEL_FE_ENERGY_GATE_ENABLE;
+extern float SL_TFLITE_MODEL_FE_ENERGY_GATE_THRESHOLD_RATIO;
+extern float SL_TFLITE_MODEL_FE_ENERGY_GATE_MIN_ENERGY;
+extern int   SL_TFLITE_MODEL_FE_ENERGY_GATE_HANGOVER_FRAMES;
 extern int   SL_TFLITE_MODEL_FE_QUANTIZE_DYNAMIC_SCALE_ENABLE;
 extern float SL_TFLITE_MODEL_FE_QUANTIZE_DYNAMIC_SCALE_RANGE_DB;
 extern float SL_TFLITE_MODEL_SAMPLEWISE_NORM_RESCALE;
@@ -90,6 +96,13 @@ extern int   SL_TFLITE_MODEL_SAMPLEWISE_NORM_MEAN_AND_STD;
 // <i> Default: 1
 #define SL_ML_AUDIO_FEATURE_GENERATION_AUDIO_GAIN                      1
 
+// <q SL_ML_AUDIO_FEATURE_GENERATION_FUSED_WINDOW_ENABLE> Fuse Gain, DC Notch Filter and Window
+// <i> Keep the window history in a ring buffer, and apply the audio gain,
+// <i> the DC notch filter and the window to the new samples in a single
+// <i> pass. The features are identical to the separate stages.
+// <i> Default: 0
+#define SL_ML_AUDIO_FEATURE_GENERATION_FUSED_WINDOW_ENABLE             0
+
 // <q SL_ML_AUDIO_FEATURE_GENERATION_MANUAL_CONFIG_ENABLE> Enable Manual Frontend Configurations
 // <i> Enable manual configuration of the Frontend
 // <i> This may overwrite settings that are already embedded in
@@ -136,6 +149,12 @@ extern int   SL_TFLITE_MODEL_SAMPLEWISE_NORM_MEAN_AND_STD;
 #define SL_ML_FRONTEND_ACTIVITY_DETECTION_TRIP_THRESHOLD      SL_TFLITE_MODEL_FE_ACTIVITY_DETECTION_TRIP_THRESHOLD
 #define SL_ML_FRONTEND_DC_NOTCH_FILTER_ENABLE                 SL_TFLITE_MODEL_FE_DC_NOTCH_FILTER_ENABLE
 #define SL_ML_FRONTEND_DC_NOTCH_FILTER_COEFFICIENT            SL_TFLITE_MODEL_FE_DC_NOTCH_FILTER_COEFFICIENT
+#define SL_ML_FRONTEND_DCT_ENABLE                             SL_TFLITE_MODEL_FE_DCT_ENABLE
+#define SL_ML_FRONTEND_DCT_N_COEFFICIENTS                     SL_TFLITE_MODEL_FE_DCT_N_COEFFICIENTS
+#define SL_ML_FRONTEND_ENERGY_GATE_ENABLE                     SL_TFLITE_MODEL_FE_ENERGY_GATE_ENABLE
+#define SL_ML_FRONTEND_ENERGY_GATE_THRESHOLD_RATIO            SL_TFLITE_MODEL_FE_ENERGY_GATE_THRESHOLD_RATIO
+#define SL_ML_FRONTEND_ENERGY_GATE_MIN_ENERGY                 SL_TFLITE_MODEL_FE_ENERGY_GATE_MIN_ENERGY
+#define SL_ML_FRONTEND_ENERGY_GATE_HANGOVER_FRAMES            SL_TFLITE_MODEL_FE_ENERGY_GATE_HANGOVER_FRAMES
 
 
 
@@ -258,6 +277,39 @@ extern int   SL_TFLITE_MODEL_SAMPLEWISE_NORM_MEAN_AND_STD;
 #define SL_ML_FRONTEND_LOG_SCALE_SHIFT                           6
 // </e>
 
+// <e> Enable DCT (MFCC output)
+// <i> Convert the log scaled filterbanks to cepstral coefficients
+// <i> Default: 0
+#define SL_ML_FRONTEND_DCT_ENABLE                                0
+
+// <o> Number of Cepstral Coefficients
+// <i> Must be less than or equal to the number of filterbank channels
+// <i> Default: 13
+#define SL_ML_FRONTEND_DCT_N_COEFFICIENTS                        13
+// </e>
+
+// <e> Enable Energy Gate
+// <i> Skip the FFT and filterbank of silent frames, and repeat the
+// <i> features of the last processed silent frame instead
+// <i> Default: 0
+#define SL_ML_FRONTEND_ENERGY_GATE_ENABLE                        0
+
+// <o> Threshold Ratio
+// <i> Frames quieter than this times the noise floor energy are silent
+// <i> Default: 4.0
+#define SL_ML_FRONTEND_ENERGY_GATE_THRESHOLD_RATIO               4.0
+
+// <o> Minimum Energy
+// <i> Frames with a lower mean square sample value are always silent
+// <i> Default: 16.0
+#define SL_ML_FRONTEND_ENERGY_GATE_MIN_ENERGY                    16.0
+
+// <o> Hangover Frames
+// <i> Number of frames still processed after a non-silent frame
+// <i> Default: 10
+#define SL_ML_FRONTEND_ENERGY_GATE_HANGOVER_FRAMES               10
+// </e>
+
 
 #define SL_ML_FRONTEND_ACTIVITY_DETECTION_ENABLE                 0
 #define SL_ML_FRONTEND_ACTIVITY_DETECTION_ALPHA_A                0.5
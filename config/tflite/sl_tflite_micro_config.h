@@ -61,6 +61,36 @@
 #define SL_TFLITE_MICRO_ARENA_SIZE                 (0)
 // </e>
 
+// <e SL_TFLITE_MICRO_STREAMING_ENABLE> Streaming convolution
+// <i> If this is enabled, the accelerated conv and depthwise_conv kernels
+// <i> cache their output rows between inferences. When the model input is
+// <i> a sliding window that is shifted along the time axis, for example by
+// <i> the audio feature generator, only the output rows depending on new
+// <i> input rows are computed. Each streaming layer keeps a copy of its
+// <i> output in persistent arena memory.
+// <i> Default: 0
+#define SL_TFLITE_MICRO_STREAMING_ENABLE           (0)
+
+// <o SL_TFLITE_MICRO_STREAMING_MAX_TENSORS> Maximum number of streaming layers
+// <i> Default: 16
+#define SL_TFLITE_MICRO_STREAMING_MAX_TENSORS      (16)
+// </e>
+
+// <o SL_TFLITE_MICRO_WEIGHT_TILE_SIZE> Compressed weight tile size
+// <i> Fully connected and convolution layers with compressed (for example
+// <i> int4 packed) weights unpack the weights into a scratch buffer of at
+// <i> most this many bytes at a time, at least one output unit or channel.
+// <i> Default: 4096
+#define SL_TFLITE_MICRO_WEIGHT_TILE_SIZE           (4096)
+
+// <q SL_TFLITE_MICRO_DEPTHWISE_UNROLLED_ENABLE> Unrolled depthwise convolution
+// <i> If this is enabled, int8 3x3 and 5x5 depthwise convolutions with a
+// <i> stride of 1 or 2 that do not run on the MVP use unrolled CPU kernels
+// <i> instead of the CMSIS-NN kernels. Compare both with the
+// <i> ml_kernel_benchmark application on the target before enabling it.
+// <i> Default: 0
+#define SL_TFLITE_MICRO_DEPTHWISE_UNROLLED_ENABLE  (0)
+
 #endif // SL_TFLITE_MICRO_CONFIG_H
 
 // <<< end of configuration section >>>
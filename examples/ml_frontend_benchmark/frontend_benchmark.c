@@ -0,0 +1,283 @@
+/***************************************************************************//**
+ * @file frontend_benchmark.c
+ * @brief Audio frontend benchmarks.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__arm__)
+#include "em_device.h"
+#else
+#include <time.h>
+#endif
+
+#include "microfrontend/lib/dc_notch_filter_util.h"
+#include "microfrontend/lib/window_util.h"
+#include "frontend_benchmark.h"
+
+// Number of measured frames per benchmark point.
+#define FRAME_COUNT         50
+
+// Largest window and step of the benchmark points, in samples.
+#define MAX_WINDOW_SIZE     1024
+#define MAX_STEP_SIZE       320
+
+// Gain of the preprocessing benchmark.
+#define PREPROCESS_GAIN     2
+
+typedef struct {
+  int sample_rate;
+  int size_ms;
+  int step_ms;
+} window_point_t;
+
+static const window_point_t window_points[] = {
+  { 8000, 30, 20 },
+  { 16000, 30, 20 },
+  { 16000, 25, 10 },
+  { 16000, 64, 16 },
+};
+
+static int16_t samples[MAX_STEP_SIZE];
+static int16_t gained_samples[MAX_STEP_SIZE];
+static int16_t reference_output[MAX_WINDOW_SIZE];
+
+static uint32_t random_state = 1;
+
+#if defined(__arm__)
+static uint32_t cpu_freq;
+#endif
+
+/*******************************************************************************
+ * Input
+ ******************************************************************************/
+
+// Noise with a slowly changing amplitude, so that the window maximum varies
+// between frames.
+static void fill_samples(int16_t *data, int count)
+{
+  for (int i = 0; i < count; i++) {
+    random_state = random_state * 1664525UL + 1013904223UL;
+    const int amplitude = 1024 + (int)((random_state >> 8) & 0x3FFF);
+    data[i] = (int16_t)((int)((random_state >> 16) % (2 * amplitude + 1)) - amplitude);
+  }
+}
+
+/*******************************************************************************
+ * Measurement
+ ******************************************************************************/
+
+// CPU cycles on a device, nanoseconds on a host.
+static uint32_t ticks(void)
+{
+#if defined(__arm__)
+  return DWT->CYCCNT;
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec);
+#endif
+}
+
+static void print_header(void)
+{
+  printf("stage,config,mode,frames,cycles_per_frame,time_us,max_diff\n");
+}
+
+// On a host no CPU cycle count is available, the cycles column is left empty
+// and the time is the host wall clock time.
+static void print_result(const char *stage, const char *config, const char *mode,
+                         int frames, uint32_t total_ticks, int max_diff)
+{
+  printf("%s,%s,%s,%d,", stage, config, mode, frames);
+#if defined(__arm__)
+  const uint32_t cycles = total_ticks / frames;
+  printf("%lu,%.2f,", (unsigned long)cycles, 1000000.0f * cycles / cpu_freq);
+#else
+  printf(",%.2f,", total_ticks / 1000.0f / frames);
+#endif
+  printf("%d\n", max_diff);
+}
+
+/*******************************************************************************
+ * Window
+ ******************************************************************************/
+
+// Feed the same samples, step size samples at a time, to a window shifting
+// its history with memmove and to a window keeping it in a ring buffer.
+static void benchmark_window(void)
+{
+  for (size_t p = 0; p < sizeof(window_points) / sizeof(window_points[0]); p++) {
+    const window_point_t *point = &window_points[p];
+    struct WindowConfig config;
+    struct WindowState states[2];
+    static const char *modes[2] = { "memmove", "ring_buffer" };
+    uint32_t total_ticks[2] = { 0, 0 };
+    int frames = 0;
+    int max_diff = 0;
+    char config_name[32];
+
+    WindowFillConfigWithDefaults(&config);
+    config.size_ms = point->size_ms;
+    config.step_size_ms = point->step_ms;
+    for (int mode = 0; mode < 2; mode++) {
+      config.ring_buffer = mode;
+      if (!WindowPopulateState(&config, &states[mode], point->sample_rate)) {
+        printf("# Failed to populate window state\n");
+        return;
+      }
+      WindowReset(&states[mode]);
+    }
+    snprintf(config_name, sizeof(config_name), "%dHz %dms/%dms",
+             point->sample_rate, point->size_ms, point->step_ms);
+
+    const int step = (int)states[0].step;
+    const int size = (int)states[0].size;
+    while (frames < FRAME_COUNT) {
+      fill_samples(samples, step);
+      int ready = 0;
+      for (int mode = 0; mode < 2; mode++) {
+        size_t num_samples_read;
+        const uint32_t start = ticks();
+        ready = WindowProcessSamples(&states[mode], NULL, samples, step, &num_samples_read);
+        total_ticks[mode] += ticks() - start;
+      }
+      if (!ready) {
+        continue;
+      }
+      frames++;
+
+      memcpy(reference_output, states[0].output, size * sizeof(*reference_output));
+      for (int i = 0; i < size; i++) {
+        const int diff = abs(states[1].output[i] - reference_output[i]);
+        max_diff = diff > max_diff ? diff : max_diff;
+      }
+      const int max_abs_diff = abs(states[1].max_abs_output_value - states[0].max_abs_output_value);
+      max_diff = max_abs_diff > max_diff ? max_abs_diff : max_diff;
+    }
+
+    for (int mode = 0; mode < 2; mode++) {
+      print_result("window", config_name, modes[mode], frames, total_ticks[mode], mode == 0 ? 0 : max_diff);
+      WindowFreeStateContents(&states[mode]);
+    }
+  }
+}
+
+/*******************************************************************************
+ * Preprocessing
+ ******************************************************************************/
+
+// Gain, DC notch filter, window and max abs of every frame. The separate mode
+// applies the gain while copying the samples to a buffer, like the audio
+// buffer of the feature generator, then runs the DC notch filter and the
+// window. The fused mode does all of them in a single pass.
+static void benchmark_preprocess(void)
+{
+  for (size_t p = 0; p < sizeof(window_points) / sizeof(window_points[0]); p++) {
+    const window_point_t *point = &window_points[p];
+    struct WindowConfig config;
+    struct DcNotchFilterConfig dc_notch_config;
+    struct WindowState states[2];
+    struct DcNotchFilterState dc_notch_states[2];
+    static const char *modes[2] = { "separate", "fused" };
+    uint32_t total_ticks[2] = { 0, 0 };
+    int frames = 0;
+    int max_diff = 0;
+    char config_name[32];
+
+    WindowFillConfigWithDefaults(&config);
+    config.size_ms = point->size_ms;
+    config.step_size_ms = point->step_ms;
+    DcNotchFilterFillConfigWithDefaults(&dc_notch_config);
+    dc_notch_config.enable_dc_notch_filter = 1;
+    for (int mode = 0; mode < 2; mode++) {
+      config.input_gain = mode == 0 ? 1 : PREPROCESS_GAIN;
+      if (!WindowPopulateState(&config, &states[mode], point->sample_rate)) {
+        printf("# Failed to populate window state\n");
+        return;
+      }
+      WindowReset(&states[mode]);
+      DcNotchFilterConfig(&dc_notch_config, &dc_notch_states[mode]);
+    }
+    snprintf(config_name, sizeof(config_name), "%dHz %dms/%dms",
+             point->sample_rate, point->size_ms, point->step_ms);
+
+    const int step = (int)states[0].step;
+    const int size = (int)states[0].size;
+    while (frames < FRAME_COUNT) {
+      size_t num_samples_read;
+      fill_samples(samples, step);
+
+      uint32_t start = ticks();
+      for (int i = 0; i < step; i++) {
+        gained_samples[i] = samples[i] * PREPROCESS_GAIN;
+      }
+      const int ready = WindowProcessSamples(&states[0], &dc_notch_states[0], gained_samples,
+                                             step, &num_samples_read);
+      total_ticks[0] += ticks() - start;
+
+      start = ticks();
+      WindowProcessSamplesFused(&states[1], &dc_notch_states[1], samples, step, &num_samples_read);
+      total_ticks[1] += ticks() - start;
+
+      if (!ready) {
+        continue;
+      }
+      frames++;
+
+      for (int i = 0; i < size; i++) {
+        const int diff = abs(states[1].output[i] - states[0].output[i]);
+        max_diff = diff > max_diff ? diff : max_diff;
+      }
+      const int max_abs_diff = abs(states[1].max_abs_output_value - states[0].max_abs_output_value);
+      max_diff = max_abs_diff > max_diff ? max_abs_diff : max_diff;
+    }
+
+    for (int mode = 0; mode < 2; mode++) {
+      print_result("preprocess", config_name, modes[mode], frames, total_ticks[mode], mode == 0 ? 0 : max_diff);
+      WindowFreeStateContents(&states[mode]);
+    }
+  }
+}
+
+/*******************************************************************************
+ * Public functions
+ ******************************************************************************/
+
+void frontend_benchmark_init(void)
+{
+  printf("\n# --------------------------------------------\n");
+  printf("# Audio frontend benchmark.\n");
+
+#if defined(__arm__)
+  cpu_freq = SystemHCLKGet();
+  printf("# CPU core frequency: %.1f MHz\n", (float)cpu_freq / 1000000.0);
+
+  // Prepare DWT core cycle counting.
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+void frontend_benchmark_process_action(void)
+{
+  print_header();
+  benchmark_window();
+  benchmark_preprocess();
+
+  printf("# Audio frontend benchmark done.\n");
+}
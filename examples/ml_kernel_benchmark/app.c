@@ -0,0 +1,53 @@
+/***************************************************************************//**
+ * @file app.c
+ * @brief Top level application functions
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+#include <stdlib.h>
+
+#include "app.h"
+#include "kernel_benchmark.h"
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+#include "sl_power_manager.h"
+#endif
+
+/***************************************************************************//**
+ * Initialize application.
+ ******************************************************************************/
+void app_init(void)
+{
+  kernel_benchmark_init();
+}
+
+/***************************************************************************//**
+ * App ticking function.
+ ******************************************************************************/
+void app_process_action(void)
+{
+  // Run all benchmarks once.
+  kernel_benchmark_process_action();
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+  sl_power_manager_sleep();
+#endif
+
+#if defined(__arm__)
+  while (1) {
+    // Spin here for ever ...
+  }
+#else
+  // Host builds run against the MVP reference model, exit when done.
+  exit(0);
+#endif
+}
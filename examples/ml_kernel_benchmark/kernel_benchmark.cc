@@ -0,0 +1,917 @@
+/***************************************************************************//**
+ * @file kernel_benchmark.cc
+ * @brief Kernel micro-benchmarks.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+#if defined(__arm__)
+#include "em_device.h"
+#else
+#include <chrono>
+#endif
+#if defined(SL_CATALOG_MVP_PRESENT)
+#include "sl_mvp.h"
+#endif
+#if defined(SL_CATALOG_TENSORFLOW_LITE_MICRO_ACCELERATED_KERNELS_PRESENT)
+#include "kernel_backend.h"
+#endif
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/test_helpers.h"
+#include "kernel_benchmark.h"
+
+using tflite::testing::CreateQuantizedTensor;
+using tflite::testing::CreateTensor;
+using tflite::testing::FloatArrayFromFloats;
+using tflite::testing::IntArrayFromInts;
+
+namespace {
+
+// Number of measured invocations per benchmark point.
+constexpr int kIterations = 10;
+
+// Tensor buffers shared by all benchmark points, sized for the largest one.
+constexpr int kMaxActivationSize = 4096;
+constexpr int kMaxWeightSize     = 32768;
+constexpr int kMaxChannels       = 128;
+constexpr int kMaxSparseSize     = 20 + 2 * (kMaxChannels + 1) + 2 * kMaxWeightSize / 16 + kMaxWeightSize;
+
+// Aligned to also hold the float tensors of the type conversion points.
+alignas(4) int8_t input_data[kMaxActivationSize];
+int8_t input2_data[kMaxActivationSize];
+alignas(4) int8_t output_data[kMaxActivationSize];
+alignas(4) int8_t reference_data[kMaxActivationSize];
+int8_t weight_data[kMaxWeightSize];
+alignas(4) uint8_t sparse_weight_data[kMaxSparseSize];
+int32_t bias_data[kMaxChannels];
+
+// Filter quantization, the first element holds the array size.
+float filter_scales[kMaxChannels + 1];
+int filter_zero_points[kMaxChannels + 1];
+TfLiteAffineQuantization filter_quantization;
+
+constexpr float kInputScale  = 0.5f;
+constexpr int   kInputZeroPoint  = 5;
+constexpr int   kOutputZeroPoint = -2;
+
+uint32_t random_state = 1;
+
+enum quant_mode { kPerTensor, kPerChannel };
+
+const char *quant_name(quant_mode quant)
+{
+  return quant == kPerChannel ? "per_channel" : "per_tensor";
+}
+
+int8_t random_int8(int range)
+{
+  random_state = random_state * 1664525UL + 1013904223UL;
+  return static_cast<int8_t>(static_cast<int>((random_state >> 16) % (2 * range + 1)) - range);
+}
+
+void fill_random(int8_t *data, int size, int range)
+{
+  for (int i = 0; i < size; i++) {
+    data[i] = random_int8(range);
+  }
+}
+
+// Output scale keeping the result of a dot product of depth random inputs and
+// weights, see fill_random(), well within the int8 range.
+float accumulator_output_scale(float weight_scale, int depth)
+{
+  return kInputScale * weight_scale * 24.0f * sqrtf(static_cast<float>(depth));
+}
+
+/*******************************************************************************
+ * Measurement
+ ******************************************************************************/
+
+struct Result {
+  const char *backend;
+  uint32_t cycles;
+  float    time_us;
+  uint32_t mvp_instructions;
+  uint32_t mvp_stall_cycles;
+  uint32_t mvp_programs;
+};
+
+struct Point {
+  const char *op;
+  char       config[64];
+  const char *quant;
+  uint32_t   macs;
+  int        output_size;
+  // Float outputs are compared in units in the last place.
+  bool       float_output = false;
+};
+
+#if defined(__arm__)
+uint32_t cpu_freq;
+#endif
+
+// Run a kernel and measure the average of kIterations invocations. On a host
+// no CPU cycle count is available. The cycle count of MVP rows is the
+// estimate of the MVP reference model, and the cycles of CPU rows are left
+// empty.
+bool run_kernel(tflite::micro::KernelRunner& runner, Result *result)
+{
+  if (runner.InitAndPrepare() != kTfLiteOk) {
+    return false;
+  }
+#if defined(SL_CATALOG_TENSORFLOW_LITE_MICRO_ACCELERATED_KERNELS_PRESENT)
+  result->backend = tflite::sl::kernel_backend::Name(tflite::sl::kernel_backend::LastSelected());
+#else
+  result->backend = "default";
+#endif
+
+  // Warm up caches and the MVP program state.
+  if (runner.Invoke() != kTfLiteOk) {
+    return false;
+  }
+
+#if defined(SL_CATALOG_MVP_PRESENT)
+  sli_mvp_perfcnt_reset_all();
+  sli_mvp_progcnt_reset();
+#endif
+#if defined(__arm__)
+  const uint32_t start = DWT->CYCCNT;
+#else
+  const auto start = std::chrono::steady_clock::now();
+#endif
+
+  for (int i = 0; i < kIterations; i++) {
+    if (runner.Invoke() != kTfLiteOk) {
+      return false;
+    }
+  }
+
+#if defined(__arm__)
+  result->cycles  = (DWT->CYCCNT - start) / kIterations;
+  result->time_us = 1000000.0f * result->cycles / cpu_freq;
+#else
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  result->cycles  = 0;
+  result->time_us = std::chrono::duration<float, std::micro>(elapsed).count() / kIterations;
+#endif
+
+  result->mvp_instructions = 0;
+  result->mvp_stall_cycles = 0;
+  result->mvp_programs     = 0;
+#if defined(SL_CATALOG_MVP_PRESENT)
+  result->mvp_instructions = sli_mvp_perfcnt_get(0) / kIterations;
+  result->mvp_programs     = sli_mvp_progcnt_get() / kIterations;
+#if defined(SL_CATALOG_ML_MVP_REFERENCE_PRESENT)
+  result->cycles           = sli_mvp_perfcnt_get(1) / kIterations;
+#else
+  result->mvp_stall_cycles = sli_mvp_perfcnt_get(1) / kIterations;
+#endif
+#endif
+  return true;
+}
+
+void print_header(void)
+{
+  printf("op,config,quant,backend,macs,cycles,cycles_per_mac,time_us,"
+         "mvp_instructions,mvp_stall_cycles,mvp_programs,max_diff\n");
+}
+
+void print_result(const Point& point, const Result& result, int max_diff)
+{
+  printf("%s,%s,%s,%s,%lu,", point.op, point.config, point.quant, result.backend,
+         (unsigned long)point.macs);
+  if (result.cycles > 0) {
+    printf("%lu,%.3f,", (unsigned long)result.cycles, (float)result.cycles / point.macs);
+  } else {
+    printf(",,");
+  }
+  printf("%.1f,%lu,%lu,%lu,%d\n", result.time_us,
+         (unsigned long)result.mvp_instructions, (unsigned long)result.mvp_stall_cycles,
+         (unsigned long)result.mvp_programs, max_diff);
+}
+
+// Backend selection of one benchmark run.
+struct BackendConfig {
+  bool mvp;
+  bool specialized;
+};
+
+// Run a benchmark point on every backend, the generic CPU kernels first.
+// Configurations selecting the same backend as the previous one are skipped.
+// The output of the first run is the reference for max_diff unless
+// keep_reference is set.
+bool run_point(const Point& point, const TFLMRegistration& registration,
+               TfLiteTensor *tensors, int tensors_size,
+               int *inputs, int *outputs, const void *builtin_data,
+               bool keep_reference = false)
+{
+#if defined(SL_CATALOG_TENSORFLOW_LITE_MICRO_ACCELERATED_KERNELS_PRESENT)
+  const BackendConfig configs[] = { { false, false }, { false, true }, { true, true } };
+#else
+  const BackendConfig configs[] = { { false, false } };
+#endif
+  const char *previous_backend = "";
+
+  for (unsigned i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+#if defined(SL_CATALOG_TENSORFLOW_LITE_MICRO_ACCELERATED_KERNELS_PRESENT)
+    tflite::sl::kernel_backend::SetMvpEnabled(configs[i].mvp);
+    tflite::sl::kernel_backend::SetSpecializedEnabled(configs[i].specialized);
+#endif
+    memset(output_data, 0, point.output_size);
+
+    Result result;
+    tflite::micro::KernelRunner runner(registration, tensors, tensors_size,
+                                       IntArrayFromInts(inputs),
+                                       IntArrayFromInts(outputs),
+                                       builtin_data);
+    if (!run_kernel(runner, &result)) {
+      printf("# %s %s: invocation failed\n", point.op, point.config);
+      return false;
+    }
+    if (strcmp(result.backend, previous_backend) == 0) {
+      continue;
+    }
+    previous_backend = result.backend;
+
+    if (i == 0 && !keep_reference) {
+      memcpy(reference_data, output_data, point.output_size);
+    }
+    int max_diff = 0;
+    if (point.float_output) {
+      for (int j = 0; j < point.output_size; j += 4) {
+        int32_t a, b;
+        memcpy(&a, &output_data[j], sizeof(a));
+        memcpy(&b, &reference_data[j], sizeof(b));
+        const int diff = std::abs(a - b);
+        max_diff = diff > max_diff ? diff : max_diff;
+      }
+    } else {
+      for (int j = 0; j < point.output_size; j++) {
+        const int diff = std::abs(output_data[j] - reference_data[j]);
+        max_diff = diff > max_diff ? diff : max_diff;
+      }
+    }
+    print_result(point, result, max_diff);
+  }
+
+#if defined(SL_CATALOG_TENSORFLOW_LITE_MICRO_ACCELERATED_KERNELS_PRESENT)
+  tflite::sl::kernel_backend::SetMvpEnabled(true);
+  tflite::sl::kernel_backend::SetSpecializedEnabled(true);
+#endif
+  return true;
+}
+
+// Attach per channel scales to a filter tensor. Per tensor quantization uses
+// the same scale for every channel.
+void set_filter_quantization(TfLiteTensor *filter, int channels, quant_mode quant,
+                             int quantized_dimension)
+{
+  filter_scales[0] = static_cast<float>(channels);
+  filter_zero_points[0] = channels;
+  for (int i = 0; i < channels; i++) {
+    filter_scales[i + 1] = quant == kPerChannel ? 0.005f + 0.001f * (i % 8) : 0.01f;
+    filter_zero_points[i + 1] = 0;
+  }
+  filter_quantization.scale = FloatArrayFromFloats(filter_scales);
+  filter_quantization.zero_point = IntArrayFromInts(filter_zero_points);
+  filter_quantization.quantized_dimension = quantized_dimension;
+  filter->params.scale = filter_scales[1];
+  filter->quantization = { kTfLiteAffineQuantization, &filter_quantization };
+}
+
+int output_size(int input_size, int filter_size, int stride, TfLitePadding padding)
+{
+  if (padding == kTfLitePaddingSame) {
+    return (input_size + stride - 1) / stride;
+  }
+  return (input_size - filter_size) / stride + 1;
+}
+
+const char *padding_name(TfLitePadding padding)
+{
+  return padding == kTfLitePaddingSame ? "same" : "valid";
+}
+
+/*******************************************************************************
+ * Convolutions
+ ******************************************************************************/
+
+struct ConvShape {
+  int height;
+  int width;
+  int in_channels;
+  int out_channels;  // Depth multiplier for depthwise_conv
+  int filter_size;
+  int stride;
+  TfLitePadding padding;
+};
+
+void benchmark_conv(void)
+{
+  const ConvShape shapes[] = {
+    { 16, 16,  8, 16, 3, 1, kTfLitePaddingSame  },
+    { 16, 16,  8, 16, 3, 2, kTfLitePaddingSame  },
+    { 16, 16, 16, 16, 1, 1, kTfLitePaddingValid },
+    { 16, 16,  3,  8, 3, 2, kTfLitePaddingValid },
+    {  8,  8, 32, 32, 3, 1, kTfLitePaddingSame  },
+    {  8,  8, 16, 32, 5, 1, kTfLitePaddingSame  },
+    {  8,  8, 64, 64, 1, 1, kTfLitePaddingValid },
+  };
+
+  for (const ConvShape& s : shapes) {
+    for (quant_mode quant : { kPerTensor, kPerChannel }) {
+      const int out_h = output_size(s.height, s.filter_size, s.stride, s.padding);
+      const int out_w = output_size(s.width, s.filter_size, s.stride, s.padding);
+      const int depth = s.filter_size * s.filter_size * s.in_channels;
+
+      int input_shape[]  = { 4, 1, s.height, s.width, s.in_channels };
+      int filter_shape[] = { 4, s.out_channels, s.filter_size, s.filter_size, s.in_channels };
+      int bias_shape[]   = { 1, s.out_channels };
+      int output_shape[] = { 4, 1, out_h, out_w, s.out_channels };
+
+      fill_random(input_data, s.height * s.width * s.in_channels, 64);
+      fill_random(weight_data, s.out_channels * depth, 16);
+      for (int i = 0; i < s.out_channels; i++) {
+        bias_data[i] = random_int8(127) * 16;
+      }
+
+      TfLiteTensor tensors[] = {
+        CreateQuantizedTensor(input_data, IntArrayFromInts(input_shape), kInputScale, kInputZeroPoint),
+        CreateQuantizedTensor(weight_data, IntArrayFromInts(filter_shape), 0.01f, 0),
+        CreateTensor(bias_data, IntArrayFromInts(bias_shape)),
+        CreateQuantizedTensor(output_data, IntArrayFromInts(output_shape),
+                              accumulator_output_scale(0.01f, depth), kOutputZeroPoint),
+      };
+      set_filter_quantization(&tensors[1], s.out_channels, quant, 0);
+
+      int inputs[]  = { 3, 0, 1, 2 };
+      int outputs[] = { 1, 3 };
+
+      TfLiteConvParams params = {};
+      params.padding = s.padding;
+      params.stride_width = s.stride;
+      params.stride_height = s.stride;
+      params.dilation_width_factor = 1;
+      params.dilation_height_factor = 1;
+      params.activation = kTfLiteActNone;
+
+      Point point;
+      point.op = "conv_2d";
+      snprintf(point.config, sizeof(point.config), "%dx%dx%d k%d s%d %s oc%d",
+               s.height, s.width, s.in_channels, s.filter_size, s.stride,
+               padding_name(s.padding), s.out_channels);
+      point.quant = quant_name(quant);
+      point.macs = out_h * out_w * s.out_channels * depth;
+      point.output_size = out_h * out_w * s.out_channels;
+      run_point(point, tflite::Register_CONV_2D(), tensors, 4, inputs, outputs, &params);
+    }
+  }
+}
+
+void benchmark_depthwise_conv(void)
+{
+  const ConvShape shapes[] = {
+    { 16, 16, 16, 1, 3, 1, kTfLitePaddingSame  },
+    { 16, 16, 16, 1, 3, 2, kTfLitePaddingSame  },
+    { 32, 32,  4, 1, 3, 1, kTfLitePaddingValid },
+    {  8,  8, 64, 1, 3, 1, kTfLitePaddingSame  },
+    {  8,  8, 32, 1, 5, 1, kTfLitePaddingSame  },
+    { 16, 16, 16, 1, 5, 2, kTfLitePaddingSame  },
+    { 16, 16,  8, 2, 3, 1, kTfLitePaddingSame  },
+  };
+
+  for (const ConvShape& s : shapes) {
+    for (quant_mode quant : { kPerTensor, kPerChannel }) {
+      const int out_h = output_size(s.height, s.filter_size, s.stride, s.padding);
+      const int out_w = output_size(s.width, s.filter_size, s.stride, s.padding);
+      const int out_channels = s.in_channels * s.out_channels;
+      const int depth = s.filter_size * s.filter_size;
+
+      int input_shape[]  = { 4, 1, s.height, s.width, s.in_channels };
+      int filter_shape[] = { 4, 1, s.filter_size, s.filter_size, out_channels };
+      int bias_shape[]   = { 1, out_channels };
+      int output_shape[] = { 4, 1, out_h, out_w, out_channels };
+
+      fill_random(input_data, s.height * s.width * s.in_channels, 64);
+      fill_random(weight_data, depth * out_channels, 16);
+      for (int i = 0; i < out_channels; i++) {
+        bias_data[i] = random_int8(127) * 4;
+      }
+
+      TfLiteTensor tensors[] = {
+        CreateQuantizedTensor(input_data, IntArrayFromInts(input_shape), kInputScale, kInputZeroPoint),
+        CreateQuantizedTensor(weight_data, IntArrayFromInts(filter_shape), 0.01f, 0),
+        CreateTensor(bias_data, IntArrayFromInts(bias_shape)),
+        CreateQuantizedTensor(output_data, IntArrayFromInts(output_shape),
+                              accumulator_output_scale(0.01f, depth), kOutputZeroPoint),
+      };
+      set_filter_quantization(&tensors[1], out_channels, quant, 3);
+
+      int inputs[]  = { 3, 0, 1, 2 };
+      int outputs[] = { 1, 3 };
+
+      TfLiteDepthwiseConvParams params = {};
+      params.padding = s.padding;
+      params.stride_width = s.stride;
+      params.stride_height = s.stride;
+      params.depth_multiplier = s.out_channels;
+      params.dilation_width_factor = 1;
+      params.dilation_height_factor = 1;
+      params.activation = kTfLiteActNone;
+
+      Point point;
+      point.op = "depthwise_conv_2d";
+      snprintf(point.config, sizeof(point.config), "%dx%dx%d k%d s%d %s m%d",
+               s.height, s.width, s.in_channels, s.filter_size, s.stride,
+               padding_name(s.padding), s.out_channels);
+      point.quant = quant_name(quant);
+      point.macs = out_h * out_w * out_channels * depth;
+      point.output_size = out_h * out_w * out_channels;
+      run_point(point, tflite::Register_DEPTHWISE_CONV_2D(), tensors, 4, inputs, outputs, &params);
+    }
+  }
+}
+
+void benchmark_transpose_conv(void)
+{
+  const ConvShape shapes[] = {
+    { 4, 4, 32, 16, 3, 2, kTfLitePaddingSame  },
+    { 8, 8, 16,  4, 3, 2, kTfLitePaddingSame  },
+    { 4, 4, 16,  8, 4, 2, kTfLitePaddingValid },
+  };
+
+  for (const ConvShape& s : shapes) {
+    for (quant_mode quant : { kPerTensor, kPerChannel }) {
+      const int out_h = s.padding == kTfLitePaddingSame ? s.height * s.stride
+                        : (s.height - 1) * s.stride + s.filter_size;
+      const int out_w = s.padding == kTfLitePaddingSame ? s.width * s.stride
+                        : (s.width - 1) * s.stride + s.filter_size;
+      const int depth = s.filter_size * s.filter_size * s.in_channels;
+
+      int output_shape_data[] = { 1, out_h, out_w, s.out_channels };
+      int shape_shape[]  = { 1, 4 };
+      int filter_shape[] = { 4, s.out_channels, s.filter_size, s.filter_size, s.in_channels };
+      int input_shape[]  = { 4, 1, s.height, s.width, s.in_channels };
+      int bias_shape[]   = { 1, s.out_channels };
+      int output_shape[] = { 4, 1, out_h, out_w, s.out_channels };
+
+      fill_random(input_data, s.height * s.width * s.in_channels, 64);
+      fill_random(weight_data, s.out_channels * depth, 16);
+      for (int i = 0; i < s.out_channels; i++) {
+        bias_data[i] = random_int8(127) * 16;
+      }
+
+      // Every output receives the contributions of about
+      // (filter_size / stride)^2 input pixels.
+      const int overlap = (s.filter_size + s.stride - 1) / s.stride;
+      TfLiteTensor tensors[] = {
+        CreateTensor(output_shape_data, IntArrayFromInts(shape_shape)),
+        CreateQuantizedTensor(weight_data, IntArrayFromInts(filter_shape), 0.01f, 0),
+        CreateQuantizedTensor(input_data, IntArrayFromInts(input_shape), kInputScale, kInputZeroPoint),
+        CreateTensor(bias_data, IntArrayFromInts(bias_shape)),
+        CreateQuantizedTensor(output_data, IntArrayFromInts(output_shape),
+                              accumulator_output_scale(0.01f, overlap * overlap * s.in_channels),
+                              kOutputZeroPoint),
+      };
+      set_filter_quantization(&tensors[1], s.out_channels, quant, 0);
+
+      int inputs[]  = { 4, 0, 1, 2, 3 };
+      int outputs[] = { 1, 4 };
+
+      TfLiteTransposeConvParams params = {};
+      params.padding = s.padding;
+      params.stride_width = s.stride;
+      params.stride_height = s.stride;
+
+      Point point;
+      point.op = "transpose_conv";
+      snprintf(point.config, sizeof(point.config), "%dx%dx%d k%d s%d %s oc%d",
+               s.height, s.width, s.in_channels, s.filter_size, s.stride,
+               padding_name(s.padding), s.out_channels);
+      point.quant = quant_name(quant);
+      point.macs = s.height * s.width * s.out_channels * depth;
+      point.output_size = out_h * out_w * s.out_channels;
+      run_point(point, tflite::Register_TRANSPOSE_CONV(), tensors, 5, inputs, outputs, &params);
+    }
+  }
+}
+
+/*******************************************************************************
+ * Fully connected
+ ******************************************************************************/
+
+constexpr float kFcWeightScale = 0.01f;
+
+// Compressed weights are a one dimensional tensor of weight_bytes bytes.
+bool run_fully_connected(const Point& point, int batches, int depth, int units,
+                         const void *weights, TfLiteType weights_type,
+                         bool keep_reference = false, int weight_bytes = 0)
+{
+  int input_shape[]  = { 2, batches, depth };
+  int weight_shape[] = { 2, units, depth };
+  if (weight_bytes > 0) {
+    weight_shape[0] = 1;
+    weight_shape[1] = weight_bytes;
+  }
+  int bias_shape[]   = { 1, units };
+  int output_shape[] = { 2, batches, units };
+
+  TfLiteTensor tensors[] = {
+    CreateQuantizedTensor(input_data, IntArrayFromInts(input_shape), kInputScale, kInputZeroPoint),
+    CreateQuantizedTensor(static_cast<const int8_t*>(weights), IntArrayFromInts(weight_shape),
+                          kFcWeightScale, 0),
+    CreateTensor(bias_data, IntArrayFromInts(bias_shape)),
+    CreateQuantizedTensor(output_data, IntArrayFromInts(output_shape),
+                          accumulator_output_scale(kFcWeightScale, depth), kOutputZeroPoint),
+  };
+  tensors[1].type = weights_type;
+  tensors[2].params.scale = kInputScale * kFcWeightScale;
+  tensors[2].params.zero_point = 0;
+
+  int inputs[]  = { 3, 0, 1, 2 };
+  int outputs[] = { 1, 3 };
+
+  TfLiteFullyConnectedParams params = {};
+  params.activation = kTfLiteActNone;
+
+  return run_point(point, tflite::Register_FULLY_CONNECTED(), tensors, 4, inputs, outputs,
+                   &params, keep_reference);
+}
+
+void benchmark_fully_connected(void)
+{
+  struct FcShape {
+    int batches;
+    int depth;
+    int units;
+  };
+  const FcShape shapes[] = {
+    { 1,   64,  32 },
+    { 1,  256, 128 },
+    { 1,  512,  10 },
+    { 1, 1024,  16 },
+    { 4,  256,  64 },
+    { 8,  256,  64 },
+  };
+
+  for (const FcShape& s : shapes) {
+    fill_random(input_data, s.batches * s.depth, 64);
+    fill_random(weight_data, s.units * s.depth, 16);
+    for (int i = 0; i < s.units; i++) {
+      bias_data[i] = random_int8(127) * 16;
+    }
+
+    Point point;
+    point.op = "fully_connected";
+    snprintf(point.config, sizeof(point.config), "b%d %dx%d", s.batches, s.units, s.depth);
+    point.quant = quant_name(kPerTensor);
+    point.macs = s.batches * s.units * s.depth;
+    point.output_size = s.batches * s.units;
+    run_fully_connected(point, s.batches, s.depth, s.units, weight_data, kTfLiteInt8);
+  }
+}
+
+/*******************************************************************************
+ * Block sparse fully connected
+ *
+ * Block sparse weights are generated with an increasing number of nonzero
+ * blocks per row of blocks. The same weights are run as a dense int8 tensor
+ * and as a block sparse tensor, see tool/tflite/tflite_block_sparse.py for
+ * the format.
+ ******************************************************************************/
+
+constexpr int kFcUnits      = 128;
+constexpr int kFcDepth      = 256;
+constexpr int kFcBlockRows  = 16;
+constexpr int kFcBlockCols  = 16;
+constexpr int kFcRowBlocks  = kFcUnits / kFcBlockRows;
+constexpr int kFcColBlocks  = kFcDepth / kFcBlockCols;
+constexpr int kFcHeaderSize = 20;
+
+bool fc_nonzero[kFcRowBlocks][kFcColBlocks];
+
+void fc_generate_weights(int blocks_per_row)
+{
+  for (int r = 0; r < kFcRowBlocks; r++) {
+    // Pick blocks_per_row distinct columns of blocks.
+    int columns[kFcColBlocks];
+    for (int c = 0; c < kFcColBlocks; c++) {
+      columns[c] = c;
+      fc_nonzero[r][c] = false;
+    }
+    for (int c = 0; c < blocks_per_row; c++) {
+      int pick = c + static_cast<int>(static_cast<uint8_t>(random_int8(127)) % (kFcColBlocks - c));
+      int tmp = columns[c];
+      columns[c] = columns[pick];
+      columns[pick] = tmp;
+      fc_nonzero[r][columns[c]] = true;
+    }
+  }
+
+  for (int row = 0; row < kFcUnits; row++) {
+    for (int col = 0; col < kFcDepth; col++) {
+      int8_t value = 0;
+      if (fc_nonzero[row / kFcBlockRows][col / kFcBlockCols]) {
+        value = random_int8(8);
+      }
+      weight_data[row * kFcDepth + col] = value;
+    }
+  }
+}
+
+// Returns the size of the block sparse buffer.
+int fc_pack_block_sparse(void)
+{
+  uint16_t block_ptr[kFcRowBlocks + 1];
+  uint16_t block_index[kFcRowBlocks * kFcColBlocks];
+  uint32_t nonzero_blocks = 0;
+
+  for (int r = 0; r < kFcRowBlocks; r++) {
+    block_ptr[r] = static_cast<uint16_t>(nonzero_blocks);
+    for (int c = 0; c < kFcColBlocks; c++) {
+      if (fc_nonzero[r][c]) {
+        block_index[nonzero_blocks++] = static_cast<uint16_t>(c);
+      }
+    }
+  }
+  block_ptr[kFcRowBlocks] = static_cast<uint16_t>(nonzero_blocks);
+
+  uint8_t *p = sparse_weight_data;
+  const uint8_t header[kFcHeaderSize] = {
+    'S', 'L', 'B', 'S', kFcBlockRows, kFcBlockCols, 0, 0,
+    static_cast<uint8_t>(nonzero_blocks), static_cast<uint8_t>(nonzero_blocks >> 8), 0, 0,
+    static_cast<uint8_t>(kFcUnits), static_cast<uint8_t>(kFcUnits >> 8), 0, 0,
+    static_cast<uint8_t>(kFcDepth), static_cast<uint8_t>(kFcDepth >> 8), 0, 0
+  };
+  memcpy(p, header, sizeof(header));
+  p += sizeof(header);
+  memcpy(p, block_ptr, sizeof(block_ptr));
+  p += sizeof(block_ptr);
+  memcpy(p, block_index, nonzero_blocks * sizeof(uint16_t));
+  p += nonzero_blocks * sizeof(uint16_t);
+
+  for (int r = 0; r < kFcRowBlocks; r++) {
+    for (int i = 0; i < kFcBlockRows; i++) {
+      const int8_t *row = &weight_data[(r * kFcBlockRows + i) * kFcDepth];
+      for (int c = 0; c < kFcColBlocks; c++) {
+        if (fc_nonzero[r][c]) {
+          memcpy(p, row + c * kFcBlockCols, kFcBlockCols);
+          p += kFcBlockCols;
+        }
+      }
+    }
+  }
+  return static_cast<int>(p - sparse_weight_data);
+}
+
+void benchmark_fully_connected_sparse(void)
+{
+  fill_random(input_data, kFcDepth, 64);
+  for (int i = 0; i < kFcUnits; i++) {
+    bias_data[i] = random_int8(127) * 16;
+  }
+
+  const int densities[] = { kFcColBlocks, kFcColBlocks * 3 / 4, kFcColBlocks / 2,
+                            kFcColBlocks / 4, kFcColBlocks / 8 };
+  for (int blocks_per_row : densities) {
+    fc_generate_weights(blocks_per_row);
+    const int sparse_bytes = fc_pack_block_sparse();
+
+    // The sparse results are compared to the dense CPU result.
+    Point point;
+    point.op = "fully_connected";
+    point.quant = quant_name(kPerTensor);
+    point.macs = kFcUnits * kFcDepth;
+    point.output_size = kFcUnits;
+    const int density = 100 * blocks_per_row / kFcColBlocks;
+
+    snprintf(point.config, sizeof(point.config), "b1 %dx%d int8 %d%%", kFcUnits, kFcDepth, density);
+    if (!run_fully_connected(point, 1, kFcDepth, kFcUnits, weight_data, kTfLiteInt8)) {
+      return;
+    }
+    snprintf(point.config, sizeof(point.config), "b1 %dx%d block_sparse_%dx%d %d%%",
+             kFcUnits, kFcDepth, kFcBlockRows, kFcBlockCols, density);
+    if (!run_fully_connected(point, 1, kFcDepth, kFcUnits, sparse_weight_data, kTfLiteUInt8, true,
+                             sparse_bytes)) {
+      return;
+    }
+  }
+}
+
+/*******************************************************************************
+ * Elementwise
+ ******************************************************************************/
+
+void benchmark_elementwise(void)
+{
+  const int lengths[] = { 256, 1024, 4096 };
+
+  for (int length : lengths) {
+    // Mixed input scales require rescaling one of the inputs.
+    for (bool mixed : { false, true }) {
+      int shape[] = { 2, 1, length };
+      fill_random(input_data, length, 64);
+      fill_random(input2_data, length, 64);
+
+      const float input2_scale = mixed ? 0.25f : kInputScale;
+      Point point;
+      point.quant = mixed ? "mixed_scale" : "same_scale";
+      point.macs = length;
+      point.output_size = length;
+      snprintf(point.config, sizeof(point.config), "%d", length);
+
+      int inputs[]  = { 2, 0, 1 };
+      int outputs[] = { 1, 2 };
+
+      {
+        TfLiteTensor tensors[] = {
+          CreateQuantizedTensor(input_data, IntArrayFromInts(shape), kInputScale, kInputZeroPoint),
+          CreateQuantizedTensor(input2_data, IntArrayFromInts(shape), input2_scale, -kInputZeroPoint),
+          CreateQuantizedTensor(output_data, IntArrayFromInts(shape), 1.0f, kOutputZeroPoint),
+        };
+        TfLiteAddParams params = {};
+        params.activation = kTfLiteActNone;
+        point.op = "add";
+        run_point(point, tflite::Register_ADD(), tensors, 3, inputs, outputs, &params);
+      }
+      {
+        TfLiteTensor tensors[] = {
+          CreateQuantizedTensor(input_data, IntArrayFromInts(shape), kInputScale, kInputZeroPoint),
+          CreateQuantizedTensor(input2_data, IntArrayFromInts(shape), input2_scale, -kInputZeroPoint),
+          CreateQuantizedTensor(output_data, IntArrayFromInts(shape),
+                                kInputScale * input2_scale * 48.0f, kOutputZeroPoint),
+        };
+        TfLiteMulParams params = {};
+        params.activation = kTfLiteActNone;
+        point.op = "mul";
+        run_point(point, tflite::Register_MUL(), tensors, 3, inputs, outputs, &params);
+      }
+    }
+  }
+}
+
+/*******************************************************************************
+ * Pooling
+ ******************************************************************************/
+
+void benchmark_pooling(void)
+{
+  const ConvShape shapes[] = {
+    { 16, 16, 16, 0, 2, 2, kTfLitePaddingValid },
+    { 16, 16, 16, 0, 3, 2, kTfLitePaddingSame  },
+    { 32, 32,  4, 0, 3, 1, kTfLitePaddingSame  },
+    {  8,  8, 64, 0, 8, 8, kTfLitePaddingValid },
+  };
+
+  for (const ConvShape& s : shapes) {
+    const int out_h = output_size(s.height, s.filter_size, s.stride, s.padding);
+    const int out_w = output_size(s.width, s.filter_size, s.stride, s.padding);
+
+    int input_shape[]  = { 4, 1, s.height, s.width, s.in_channels };
+    int output_shape[] = { 4, 1, out_h, out_w, s.in_channels };
+    fill_random(input_data, s.height * s.width * s.in_channels, 100);
+
+    TfLiteTensor tensors[] = {
+      CreateQuantizedTensor(input_data, IntArrayFromInts(input_shape), kInputScale, kInputZeroPoint),
+      CreateQuantizedTensor(output_data, IntArrayFromInts(output_shape), kInputScale, kInputZeroPoint),
+    };
+    int inputs[]  = { 1, 0 };
+    int outputs[] = { 1, 1 };
+
+    TfLitePoolParams params = {};
+    params.padding = s.padding;
+    params.stride_width = s.stride;
+    params.stride_height = s.stride;
+    params.filter_width = s.filter_size;
+    params.filter_height = s.filter_size;
+    params.activation = kTfLiteActNone;
+
+    Point point;
+    snprintf(point.config, sizeof(point.config), "%dx%dx%d k%d s%d %s",
+             s.height, s.width, s.in_channels, s.filter_size, s.stride, padding_name(s.padding));
+    point.quant = quant_name(kPerTensor);
+    point.macs = out_h * out_w * s.in_channels * s.filter_size * s.filter_size;
+    point.output_size = out_h * out_w * s.in_channels;
+
+    point.op = "average_pool_2d";
+    run_point(point, tflite::Register_AVERAGE_POOL_2D(), tensors, 2, inputs, outputs, &params);
+    point.op = "max_pool_2d";
+    run_point(point, tflite::Register_MAX_POOL_2D(), tensors, 2, inputs, outputs, &params);
+  }
+}
+
+/*******************************************************************************
+ * Type conversion
+ ******************************************************************************/
+
+void benchmark_type_conversion(void)
+{
+  const int lengths[] = { 256, 1024 };
+  // Not a power of two, so that the conversions round.
+  const float scale = 0.0371f;
+
+  for (int length : lengths) {
+    int shape[] = { 2, 1, length };
+    int inputs[]  = { 1, 0 };
+    int outputs[] = { 1, 1 };
+
+    Point point;
+    snprintf(point.config, sizeof(point.config), "%d", length);
+    point.quant = quant_name(kPerTensor);
+    point.macs = length;
+
+    {
+      // Values up to 1.5 times the int8 range, so that some of them saturate.
+      float *values = reinterpret_cast<float *>(input_data);
+      for (int i = 0; i < length; i++) {
+        values[i] = random_int8(127) * scale * 1.5f + random_int8(64) * scale / 128.0f;
+      }
+      TfLiteTensor tensors[] = {
+        CreateTensor(values, IntArrayFromInts(shape)),
+        CreateQuantizedTensor(output_data, IntArrayFromInts(shape), scale, kOutputZeroPoint),
+      };
+      point.op = "quantize";
+      point.output_size = length;
+      point.float_output = false;
+      run_point(point, tflite::Register_QUANTIZE(), tensors, 2, inputs, outputs, nullptr);
+    }
+    {
+      fill_random(input_data, length, 127);
+      TfLiteTensor tensors[] = {
+        CreateQuantizedTensor(input_data, IntArrayFromInts(shape), scale, kInputZeroPoint),
+        CreateTensor(reinterpret_cast<float *>(output_data), IntArrayFromInts(shape)),
+      };
+      point.op = "dequantize";
+      point.output_size = length * static_cast<int>(sizeof(float));
+      point.float_output = true;
+      run_point(point, tflite::Register_DEQUANTIZE(), tensors, 2, inputs, outputs, nullptr);
+    }
+  }
+}
+
+}  // namespace
+
+void kernel_benchmark_init(void)
+{
+  printf("\n# --------------------------------------------\n");
+  printf("# Kernel benchmark.\n");
+
+#if defined(__arm__)
+  cpu_freq = SystemHCLKGet();
+  printf("# CPU core frequency: %.1f MHz\n", (float)cpu_freq / 1000000.0);
+
+  // Prepare DWT core cycle counting.
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+#if defined(SL_CATALOG_MVP_PRESENT)
+  sli_mvp_perfcnt_conf(0, SLI_MVP_PERFCNT_INSTRUCTIONS);
+#if defined(SL_CATALOG_ML_MVP_REFERENCE_PRESENT)
+  printf("# MVP reference model, outputs are approximate, cycles are estimated MVP cycles.\n");
+  sli_mvp_perfcnt_conf(1, SLI_MVP_PERFCNT_RUN);
+#endif
+#endif
+#if !defined(__arm__)
+  printf("# Host build, no cycle count for CPU rows, time_us is host time.\n");
+#endif
+}
+
+void kernel_benchmark_process_action(void)
+{
+  print_header();
+  benchmark_conv();
+  benchmark_depthwise_conv();
+  benchmark_transpose_conv();
+  benchmark_fully_connected();
+  benchmark_fully_connected_sparse();
+  benchmark_elementwise();
+  benchmark_pooling();
+  benchmark_type_conversion();
+
+  printf("# Kernel benchmark done.\n");
+#if defined(SL_CATALOG_MVP_PRESENT)
+  sli_mvp_deinit();
+#endif
+}
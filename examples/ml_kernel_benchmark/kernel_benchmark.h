@@ -0,0 +1,32 @@
+/***************************************************************************//**
+ * @file kernel_benchmark.h
+ * @brief Kernel micro-benchmarks.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+#ifndef KERNEL_BENCHMARK_H
+#define KERNEL_BENCHMARK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void kernel_benchmark_init(void);
+void kernel_benchmark_process_action(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // KERNEL_BENCHMARK_H
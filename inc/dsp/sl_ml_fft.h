@@ -50,12 +50,17 @@ struct complex_int16_t {
 };
 
 
-/// FFT state
+/// FFT state, every instance can have a different FFT size
 struct sli_ml_fft_state {
   int16_t* input;                   ///< Pointer to the input buffer
   struct complex_int16_t* output;   ///< Pointer to the output buffer
   size_t input_size;                ///< Size of input buffer
   size_t fft_size;                  ///< Size of FFT 
+  const int16_t* coeff_table_a;     ///< Real coefficient table A
+  const int16_t* coeff_table_b;     ///< Real coefficient table B
+  uint16_t coeff_table_stride;      ///< Coefficients to step over per use
+  int16_t* coeff_table_ram;         ///< RAM copy of the tables, or NULL
+  const void* cfft;                 ///< Complex FFT instance of half the size
 };
 
 #else 
@@ -84,8 +89,16 @@ void sli_ml_fft_compute(struct sli_ml_fft_state* state, const int16_t* input,
  *
  * @note The buffer input size does not need to be equal to the FFT size, but 
  * it can not be larger. 
+ * @note The FFT size can not be larger than SL_ML_FFT_MAX_LENGTH. Several
+ * states, with different sizes, can be used at the same time.
  *****************************************************************************/
 sl_status_t sli_ml_fft_init(struct sli_ml_fft_state* state, size_t input_size);
+
+/**************************************************************************//**
+ * Free the buffers of the FFT state struct
+ *
+ * @param state The FFT state
+ *****************************************************************************/
 void sli_ml_fft_deinit(struct sli_ml_fft_state* state);
 
 /**************************************************************************//**
@@ -221,6 +221,7 @@ sl_status_t sl_ml_audio_feature_generation_update_features();
 /***************************************************************************//**
  * @brief
  *    Retrieve the features as type uint16 and copy them to the provided buffer.
+ *    With the DCT enabled, the features are int16 cepstral coefficients.
  *
  * @param[out] buffer
  *    Pointer to the buffer to store the feature data
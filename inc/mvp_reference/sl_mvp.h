@@ -0,0 +1,108 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model driver API.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MVP_H
+#define SL_MVP_H
+
+#include "sl_mvp_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @addtogroup mvp_reference MVP Reference Model
+ * Approximate host reference of the MVP driver and ML kernel API. The ML
+ * kernels are computed on the CPU with binary16 arithmetic, rounding every ALU
+ * operation to nearest even, and the performance counters report an estimate
+ * of the work the MVP would have done. This allows the accelerated TensorFlow
+ * Lite Micro kernels to be built, tested and benchmarked on a host. The
+ * accumulation order differs from the MVP lanes, results are not bit-exact.
+ * @{
+ ******************************************************************************/
+
+/// Number of performance counters.
+#define SLI_MVP_PERFCNT_COUNT   2
+
+/// Events which can be counted by a performance counter.
+typedef enum {
+  SLI_MVP_PERFCNT_RUN,          ///< Cycles the MVP is running a program
+  SLI_MVP_PERFCNT_STALL,        ///< Cycles the MVP is stalled on memory
+  SLI_MVP_PERFCNT_INSTRUCTIONS, ///< Executed instructions
+} sli_mvp_perfcnt_event_t;
+
+/***************************************************************************//**
+ * Initialize the MVP. Resets all counters.
+ ******************************************************************************/
+sl_status_t sli_mvp_init(void);
+
+/***************************************************************************//**
+ * Deinitialize the MVP.
+ ******************************************************************************/
+sl_status_t sli_mvp_deinit(void);
+
+/***************************************************************************//**
+ * Select the event counted by a performance counter. Counter 0 counts
+ * SLI_MVP_PERFCNT_RUN and counter 1 SLI_MVP_PERFCNT_STALL by default.
+ *
+ * @param counter Performance counter, 0 to SLI_MVP_PERFCNT_COUNT - 1
+ * @param event Event to count
+ ******************************************************************************/
+void sli_mvp_perfcnt_conf(unsigned counter, sli_mvp_perfcnt_event_t event);
+
+/***************************************************************************//**
+ * Reset all performance counters to 0.
+ ******************************************************************************/
+void sli_mvp_perfcnt_reset_all(void);
+
+/***************************************************************************//**
+ * Read a performance counter.
+ *
+ * @param counter Performance counter, 0 to SLI_MVP_PERFCNT_COUNT - 1
+ ******************************************************************************/
+uint32_t sli_mvp_perfcnt_get(unsigned counter);
+
+/***************************************************************************//**
+ * Reset the count of executed programs.
+ ******************************************************************************/
+void sli_mvp_progcnt_reset(void);
+
+/***************************************************************************//**
+ * Read the count of programs executed since the last reset.
+ ******************************************************************************/
+uint32_t sli_mvp_progcnt_get(void);
+
+/** @} (end addtogroup mvp_reference) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_MVP_H
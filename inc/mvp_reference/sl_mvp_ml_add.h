@@ -0,0 +1,66 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model elementwise add kernel.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MVP_ML_ADD_H
+#define SL_MVP_ML_ADD_H
+
+#include "sl_mvp_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  const int8_t *input1;
+  const int8_t *input2;
+  int8_t       *output;
+  int32_t      input1_offset;       ///< Added to every value of input1
+  int32_t      input2_offset;       ///< Added to every value of input2
+  int32_t      output_offset;       ///< Added to every output value
+  float        input1_multiplier;   ///< Scale of input1
+  float        input2_multiplier;   ///< Scale of input2
+  float        output_multiplier;   ///< Inverse of the output scale
+  size_t       length;              ///< Number of elements
+  int8_t       activation_min;
+  int8_t       activation_max;
+} sli_mvp_ml_add_s8_params_t;
+
+/***************************************************************************//**
+ * Add two int8 tensors of the same shape.
+ *
+ * @return SL_STATUS_INVALID_PARAMETER if the parameters are not supported.
+ ******************************************************************************/
+sl_status_t sli_mvp_ml_add_s8(const sli_mvp_ml_add_s8_params_t *params);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_MVP_ML_ADD_H
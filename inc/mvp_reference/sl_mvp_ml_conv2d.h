@@ -0,0 +1,91 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model conv2d kernel.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MVP_ML_CONV2D_H
+#define SL_MVP_ML_CONV2D_H
+
+#include "sl_mvp_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  int             batches;
+  int             in_channels;
+  int             input_height;
+  int             input_width;
+  int             out_channels;
+  int             output_height;
+  int             output_width;
+  int             filter_height;
+  int             filter_width;
+  int             input_offset;           ///< Added to every input value
+  int             output_offset;          ///< Added to every output value
+  int             stride_height;
+  int             stride_width;
+  int             dilation_height;
+  int             dilation_width;
+  bool            padding;                ///< True for SAME padding
+  int             pad_height;
+  int             pad_width;
+  const float16_t *bias;                  ///< Per channel bias times SLI_MVP_ACCUMULATOR_SCALER, or NULL
+  const float16_t *output_scaler;         ///< Per channel output scale times SLI_MVP_ACCUMULATOR_MULTIPLIER
+  int32_t         output_activation_min;
+  int32_t         output_activation_max;
+  const int8_t    *input;                 ///< Input, NHWC
+  int8_t          *output;                ///< Output, NHWC
+  const int8_t    *filter;                ///< Filter, [out_channels, filter_height, filter_width, in_channels]
+  float16_t       *scratch_buffer;        ///< See sli_mvp_ml_conv2d_s8_get_scratch_buffer_size()
+} sli_mvp_ml_conv2d_s8_params_t;
+
+/***************************************************************************//**
+ * Compute a 2D convolution with int8 input, filter and output.
+ *
+ * @return SL_STATUS_INVALID_PARAMETER if the parameters are not supported.
+ ******************************************************************************/
+sl_status_t sli_mvp_ml_conv2d_s8(const sli_mvp_ml_conv2d_s8_params_t *params);
+
+/***************************************************************************//**
+ * Check if a 2D convolution can be computed by the MVP. The data pointers are
+ * not checked.
+ ******************************************************************************/
+bool sli_mvp_ml_conv2d_s8_is_supported(const sli_mvp_ml_conv2d_s8_params_t *params);
+
+/***************************************************************************//**
+ * Size in bytes of the scratch buffer required by sli_mvp_ml_conv2d_s8().
+ ******************************************************************************/
+int sli_mvp_ml_conv2d_s8_get_scratch_buffer_size(const sli_mvp_ml_conv2d_s8_params_t *params);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_MVP_ML_CONV2D_H
@@ -0,0 +1,85 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model fully connected kernel.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MVP_ML_FULLY_CONNECTED_H
+#define SL_MVP_ML_FULLY_CONNECTED_H
+
+#include "sl_mvp_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  const int8_t    *input;             ///< Input, [batches, depth]
+  sli_nn_shape_t  input_shape;
+  int32_t         input_offset;       ///< Added to every input value
+  const int8_t    *weight;            ///< Weights, [units, depth]
+  sli_nn_shape_t  weight_shape;
+  int32_t         weight_offset;      ///< Added to every weight value
+  const float16_t *bias;              ///< Bias converted with sli_mvp_ml_fully_connected_bias_convert(), or NULL
+  size_t          bias_length;
+  int8_t          *output;            ///< Output, [batches, units]
+  sli_nn_shape_t  output_shape;
+  int32_t         output_offset;      ///< Added to every output value
+  float16_t       output_multiplier;  ///< See sli_mvp_ml_fully_connected_output_multiplier()
+  int8_t          activation_min;
+  int8_t          activation_max;
+} sli_mvp_ml_fully_connected_s8_params_t;
+
+/***************************************************************************//**
+ * Compute a fully connected layer with int8 input, weights and output.
+ *
+ * @return SL_STATUS_INVALID_PARAMETER if the parameters are not supported.
+ ******************************************************************************/
+sl_status_t sli_mvp_ml_fully_connected_s8(const sli_mvp_ml_fully_connected_s8_params_t *params);
+
+/***************************************************************************//**
+ * Check if a fully connected layer can be computed by the MVP. The data
+ * pointers are not checked.
+ ******************************************************************************/
+bool sli_mvp_ml_fully_connected_s8_is_supported(const sli_mvp_ml_fully_connected_s8_params_t *params);
+
+/***************************************************************************//**
+ * Convert an int32 bias vector to the binary16 accumulator scale.
+ ******************************************************************************/
+sl_status_t sli_mvp_ml_fully_connected_bias_convert(const int32_t *src, float16_t *dst, size_t length);
+
+/***************************************************************************//**
+ * Convert the real output multiplier, input_scale * weight_scale /
+ * output_scale, to the binary16 output multiplier.
+ ******************************************************************************/
+float16_t sli_mvp_ml_fully_connected_output_multiplier(double multiplier);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_MVP_ML_FULLY_CONNECTED_H
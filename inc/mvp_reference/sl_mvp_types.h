@@ -0,0 +1,70 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model data types.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MVP_TYPES_H
+#define SL_MVP_TYPES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// IEEE 754 binary16 value, the native data type of the MVP ALU.
+typedef _Float16 float16_t;
+
+/// Largest finite binary16 value.
+#define SLI_MVP_FP16_MAX                 65504.0f
+/// Smallest (most negative) finite binary16 value.
+#define SLI_MVP_FP16_MIN                 (-65504.0f)
+
+/// Scale applied to int32 accumulator values (bias) when converted to
+/// binary16, keeps the accumulator within the binary16 range.
+#define SLI_MVP_ACCUMULATOR_SCALER       (1.0f / 1024.0f)
+/// Inverse of SLI_MVP_ACCUMULATOR_SCALER, folded into the output scalers.
+#define SLI_MVP_ACCUMULATOR_MULTIPLIER   1024.0f
+
+/// Maximum number of elements along one dimension of an MVP array or loop.
+#define SLI_MVP_MAX_DIM_SIZE             1024
+
+/// Tensor shape, unused trailing dimensions are 0.
+typedef struct {
+  uint32_t dim[4];
+} sli_nn_shape_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_MVP_TYPES_H
@@ -0,0 +1,112 @@
+/***************************************************************************//**
+ * @file
+ * @brief Streaming inference support for TensorFlow Lite Micro.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_TFLITE_MICRO_STREAMING_H
+#define SL_TFLITE_MICRO_STREAMING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @addtogroup tflite_micro_streaming TensorFlow Lite Micro Streaming
+ * Sliding window models, such as keyword spotting on a spectrogram, see an
+ * input which differs from the previous inference only by a few new rows
+ * appended along the time axis (dimension 1 of an NHWC tensor). When
+ * SL_TFLITE_MICRO_STREAMING_ENABLE is set, the accelerated convolution
+ * kernels use this information to cache their output rows between
+ * inferences and only compute the rows which depend on new input data.
+ *
+ * The model input tensor is registered by its tensor index using
+ * @ref sl_tflite_micro_streaming_register_input before the tensors are
+ * allocated. The TensorFlow Lite Micro init function registers input 0 of
+ * the model automatically. The producer of the model input, e.g. the audio
+ * feature generator, reports each update of the input tensor using
+ * @ref sl_tflite_micro_streaming_input_update. The input must be an exact
+ * shift of the previous input, i.e. all rows except the new ones must be
+ * bit-identical to the rows they replaced. Streaming is applied to
+ * convolution layers that read the model input directly and to chains of
+ * convolution layers following them. Any other operator between two
+ * convolutions ends the chain and the following layers are computed in full.
+ * @{
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @brief
+ *  Register the model input tensor which is updated using
+ *  @ref sl_tflite_micro_streaming_input_update. Convolution layers reading
+ *  this tensor resolve the registration when the tensors are allocated, so
+ *  it must be called before AllocateTensors() of the interpreter.
+ *
+ * @param[in] tensor_index Index of the input tensor in the primary subgraph
+ *   of the model, or -1 to disable streaming from the model input.
+ ******************************************************************************/
+void sl_tflite_micro_streaming_register_input(int tensor_index);
+
+/***************************************************************************//**
+ * @brief
+ *  Report that the registered model input tensor has been updated.
+ *
+ * @param[in] row_size Size in bytes of one row (time slice) of the input.
+ * @param[in] num_rows Number of rows in the input tensor.
+ * @param[in] new_rows Number of rows shifted into the end of the input since
+ *   the previous update, or -1 if the whole input has changed.
+ ******************************************************************************/
+void sl_tflite_micro_streaming_input_update(size_t row_size,
+                                            int num_rows,
+                                            int new_rows);
+
+/***************************************************************************//**
+ * @brief
+ *  Invalidate all cached streaming state. The next inference computes every
+ *  layer in full.
+ ******************************************************************************/
+void sl_tflite_micro_streaming_reset(void);
+
+/** @} (end addtogroup tflite_micro_streaming) */
+
+// Internal functions used by the kernel implementations.
+uint32_t sli_tflite_micro_streaming_get_sequence(void);
+bool sli_tflite_micro_streaming_is_input(int tensor_index);
+int sli_tflite_micro_streaming_get_input_shift(size_t row_size,
+                                               int num_rows,
+                                               uint32_t last_sequence);
+bool sli_tflite_micro_streaming_get_tensor_shift(const void *tensor, int *rows_shift);
+void sli_tflite_micro_streaming_set_tensor_shift(const void *tensor, int rows_shift);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SL_TFLITE_MICRO_STREAMING_H */
@@ -0,0 +1,45 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#include "microfrontend/lib/dct.h"
+
+#define kint16min (-32768)
+#define kint16max 32767
+
+void DctApply(const struct DctState* state, const uint16_t* input,
+              int16_t* output) {
+  const int num_channels = state->num_channels;
+  const int16_t* cosines = state->cosines;
+  int k;
+  for (k = 0; k < state->num_coefficients; ++k) {
+    // Channels are at most 16 bits and the cosines 15 bits, the sum needs a
+    // 64 bit accumulator.
+    int64_t sum = 0;
+    int n;
+    for (n = 0; n < num_channels; ++n) {
+      sum += (int32_t)input[n] * cosines[n];
+    }
+    cosines += num_channels;
+
+    int64_t result = (sum + (1 << (kDctCosineBits - 1))) >> kDctCosineBits;
+    if (result < kint16min) {
+      result = kint16min;
+    } else if (result > kint16max) {
+      result = kint16max;
+    }
+    *output++ = (int16_t)result;
+  }
+}
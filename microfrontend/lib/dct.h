@@ -0,0 +1,51 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#ifndef MICROFRONTEND_LIB_DCT_H_
+#define MICROFRONTEND_LIB_DCT_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "microfrontend/lib/utils.h"
+
+#define kDctCosineBits 15
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct DctState {
+  int enable_dct;
+  int num_channels;
+  int num_coefficients;
+  // Orthonormal DCT-II basis, num_coefficients rows of num_channels cosines
+  // in Q15.
+  int16_t* cosines;
+  int16_t* output;
+};
+
+// Converts the log scaled filterbank channels to cepstral coefficients with a
+// DCT-II, and writes num_coefficients values to output. The output can not be
+// the input array.
+ void DctApply(const struct DctState* state, const uint16_t* input,
+              int16_t* output);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // MICROFRONTEND_LIB_DCT_H_
@@ -0,0 +1,75 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#include "microfrontend/lib/dct_util.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#define kint16max 32767
+
+void DctFillConfigWithDefaults(struct DctConfig* config) {
+  config->enable_dct = 0;
+  config->num_coefficients = 13;
+}
+
+int DctPopulateState(const struct DctConfig* config, struct DctState* state,
+                     int num_channels) {
+  state->enable_dct = config->enable_dct;
+  state->num_channels = num_channels;
+  state->num_coefficients = config->num_coefficients;
+  state->cosines = NULL;
+  state->output = NULL;
+  if (!state->enable_dct) {
+    return 1;
+  }
+
+  if (config->num_coefficients < 1 ||
+      config->num_coefficients > num_channels) {
+    fprintf(stderr, "Number of DCT coefficients must be 1 to %d\n",
+            num_channels);
+    return 0;
+  }
+
+  state->cosines = (int16_t*)malloc(config->num_coefficients * num_channels *
+                                    sizeof(*state->cosines));
+  state->output =
+      (int16_t*)malloc(config->num_coefficients * sizeof(*state->output));
+  if (state->cosines == NULL || state->output == NULL) {
+    fprintf(stderr, "Failed to allocate DCT buffers\n");
+    return 0;
+  }
+
+  // Orthonormal scaling, as used by tf.signal.mfccs_from_log_mel_spectrograms.
+  const float pi = 3.14159265358979f;
+  int k;
+  for (k = 0; k < config->num_coefficients; ++k) {
+    const float scale = sqrtf((k == 0 ? 1.0f : 2.0f) / num_channels);
+    int n;
+    for (n = 0; n < num_channels; ++n) {
+      const float cosine = scale * cosf(pi * (n + 0.5f) * k / num_channels);
+      const float value = cosine * (1 << kDctCosineBits);
+      state->cosines[k * num_channels + n] =
+          (value >= kint16max) ? kint16max : (int16_t)floorf(value + 0.5f);
+    }
+  }
+  return 1;
+}
+
+void DctFreeStateContents(struct DctState* state) {
+  free(state->cosines);
+  free(state->output);
+}
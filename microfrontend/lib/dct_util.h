@@ -0,0 +1,48 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#ifndef MICROFRONTEND_LIB_DCT_UTIL_H_
+#define MICROFRONTEND_LIB_DCT_UTIL_H_
+
+#include "microfrontend/lib/utils.h"
+#include "microfrontend/lib/dct.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct DctConfig {
+  // set to false (0) to disable this module
+  int enable_dct;
+  // number of cepstral coefficients, at most the number of channels
+  int num_coefficients;
+};
+
+// Populates the DctConfig with "sane" default values.
+ void DctFillConfigWithDefaults(struct DctConfig* config);
+
+// Allocates any buffers.
+ int DctPopulateState(const struct DctConfig* config, struct DctState* state,
+                     int num_channels);
+
+// Frees any allocated buffers.
+ void DctFreeStateContents(struct DctState* state);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // MICROFRONTEND_LIB_DCT_UTIL_H_
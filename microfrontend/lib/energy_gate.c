@@ -0,0 +1,85 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#include "microfrontend/lib/energy_gate.h"
+
+#include <string.h>
+
+int EnergyGateSkipFrame(struct EnergyGateState* state, const int16_t* frame,
+                        size_t frame_size) {
+  // Mean square and zero crossings of the frame.
+  uint64_t sum = 0;
+  int crossings = 0;
+  int16_t previous = frame[0];
+  size_t i;
+  for (i = 0; i < frame_size; ++i) {
+    const int32_t sample = frame[i];
+    sum += (uint32_t)(sample * sample);
+    crossings += (sample ^ previous) < 0;
+    previous = (int16_t)sample;
+  }
+  const uint32_t energy = (uint32_t)(sum / frame_size);
+
+  // The noise floor follows the energy down immediately, and up slowly.
+  if (energy < state->noise_floor) {
+    state->noise_floor = energy;
+  } else {
+    state->noise_floor +=
+        (energy - state->noise_floor) >> state->floor_smoothing_bits;
+  }
+
+  uint64_t threshold =
+      ((uint64_t)state->noise_floor * state->threshold_ratio) >>
+      kEnergyGateRatioBits;
+  if (threshold < state->min_energy) {
+    threshold = state->min_energy;
+  }
+  // Unvoiced speech is quiet but crosses zero often, it needs to be quieter
+  // to count as silence.
+  if (crossings > state->zero_crossing_threshold) {
+    threshold >>= 1;
+  }
+
+  if (energy >= threshold) {
+    state->hangover = state->hangover_frames;
+    state->silence_valid = 0;
+    state->frame_silent = 0;
+    return 0;
+  }
+  if (state->hangover > 0) {
+    --state->hangover;
+    state->frame_silent = 0;
+    return 0;
+  }
+  state->frame_silent = 1;
+  return state->silence_valid;
+}
+
+void EnergyGateStoreFrame(struct EnergyGateState* state,
+                          const uint16_t* output) {
+  if (state->frame_silent && !state->silence_valid) {
+    memcpy(state->silence_output, output,
+           state->output_size * sizeof(*state->silence_output));
+    state->silence_valid = 1;
+  }
+}
+
+void EnergyGateReset(struct EnergyGateState* state) {
+  state->noise_floor = UINT32_MAX;
+  state->hangover = state->hangover_frames;
+  state->frame_silent = 0;
+  state->silence_valid = 0;
+}
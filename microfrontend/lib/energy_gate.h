@@ -0,0 +1,64 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#ifndef MICROFRONTEND_LIB_ENERGY_GATE_H_
+#define MICROFRONTEND_LIB_ENERGY_GATE_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "microfrontend/lib/utils.h"
+
+#define kEnergyGateRatioBits 8
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Skips the FFT and filterbank of silent frames, and outputs the features of
+// the last processed silent frame instead.
+struct EnergyGateState {
+  int enable_energy_gate;
+  uint32_t threshold_ratio;       // threshold over the noise floor, Q8
+  uint32_t min_energy;            // lowest threshold, mean square of a sample
+  int floor_smoothing_bits;       // noise floor rise time, in 2^bits frames
+  int zero_crossing_threshold;    // zero crossings per frame of unvoiced sound
+  int hangover_frames;            // frames processed after a non-silent frame
+  uint32_t noise_floor;           // mean square of the noise floor
+  int hangover;                   // remaining hangover frames
+  int frame_silent;               // 1 when the last frame was silent
+  int silence_valid;              // 1 when silence_output holds a frame
+  size_t output_size;
+  uint16_t* silence_output;
+};
+
+// Classifies the windowed frame. Returns 1 when it is silent and its features
+// can be taken from the silence frame, 0 when it must be processed.
+ int EnergyGateSkipFrame(struct EnergyGateState* state, const int16_t* frame,
+                        size_t frame_size);
+
+// Keeps the features of a processed frame as the silence frame, when the frame
+// was silent.
+ void EnergyGateStoreFrame(struct EnergyGateState* state,
+                          const uint16_t* output);
+
+ void EnergyGateReset(struct EnergyGateState* state);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // MICROFRONTEND_LIB_ENERGY_GATE_H_
@@ -0,0 +1,59 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#include "microfrontend/lib/energy_gate_util.h"
+
+#include <stdio.h>
+
+void EnergyGateFillConfigWithDefaults(struct EnergyGateConfig* config) {
+  config->enable_energy_gate = 0;
+  config->threshold_ratio = 4.0;
+  config->min_energy = 16.0;
+  config->floor_smoothing_bits = 10;
+  config->zero_crossing_rate = 0.3;
+  config->hangover_frames = 10;
+}
+
+int EnergyGatePopulateState(const struct EnergyGateConfig* config,
+                            struct EnergyGateState* state, size_t frame_size,
+                            size_t output_size) {
+  state->enable_energy_gate = config->enable_energy_gate;
+  state->silence_output = NULL;
+  if (!state->enable_energy_gate) {
+    return 1;
+  }
+
+  state->threshold_ratio =
+      (uint32_t)(config->threshold_ratio * (1 << kEnergyGateRatioBits));
+  state->min_energy = (uint32_t)config->min_energy;
+  state->floor_smoothing_bits = config->floor_smoothing_bits;
+  state->zero_crossing_threshold =
+      (int)(config->zero_crossing_rate * frame_size);
+  state->hangover_frames = config->hangover_frames;
+  state->output_size = output_size;
+  state->silence_output =
+      (uint16_t*)malloc(output_size * sizeof(*state->silence_output));
+  if (state->silence_output == NULL) {
+    fprintf(stderr, "Failed to allocate silence frame\n");
+    return 0;
+  }
+  EnergyGateReset(state);
+  return 1;
+}
+
+void EnergyGateFreeStateContents(struct EnergyGateState* state) {
+  free(state->silence_output);
+}
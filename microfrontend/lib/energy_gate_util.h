@@ -0,0 +1,59 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#ifndef MICROFRONTEND_LIB_ENERGY_GATE_UTIL_H_
+#define MICROFRONTEND_LIB_ENERGY_GATE_UTIL_H_
+
+#include "microfrontend/lib/utils.h"
+#include "microfrontend/lib/energy_gate.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct EnergyGateConfig {
+  // set to false (0) to disable this module
+  int enable_energy_gate;
+  // frames below threshold_ratio times the noise floor energy are silent
+  float threshold_ratio;
+  // frames below this mean square sample value are always silent
+  float min_energy;
+  // the noise floor rises to a louder level in about 2^floor_smoothing_bits
+  // frames
+  int floor_smoothing_bits;
+  // fraction of samples crossing zero above which a frame may be unvoiced
+  // speech
+  float zero_crossing_rate;
+  // number of frames still processed after a non-silent frame
+  int hangover_frames;
+};
+
+// Populates the EnergyGateConfig with "sane" default values.
+ void EnergyGateFillConfigWithDefaults(struct EnergyGateConfig* config);
+
+// Allocates any buffers.
+ int EnergyGatePopulateState(const struct EnergyGateConfig* config,
+                            struct EnergyGateState* state, size_t frame_size,
+                            size_t output_size);
+
+// Frees any allocated buffers.
+ void EnergyGateFreeStateContents(struct EnergyGateState* state);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // MICROFRONTEND_LIB_ENERGY_GATE_UTIL_H_
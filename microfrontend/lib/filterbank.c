@@ -65,6 +65,91 @@ void FilterbankAccumulateChannels(struct FilterbankState* state,
   }
 }
 
+#if FILTERBANK_FAST_SQRT
+// Estimates of sqrt((i + 64.5) << 24), the square root of a normalized value
+// from its top 8 bits.
+static const uint16_t kSqrtLut[192] = {
+    32896, 33150, 33402, 33652, 33900, 34147, 34392, 34635, 34876, 35116,
+    35354, 35590, 35825, 36059, 36291, 36521, 36750, 36978, 37204, 37429,
+    37652, 37874, 38095, 38315, 38533, 38750, 38966, 39181, 39394, 39606,
+    39818, 40028, 40237, 40445, 40652, 40857, 41062, 41266, 41469, 41671,
+    41871, 42071, 42270, 42468, 42665, 42861, 43057, 43251, 43445, 43637,
+    43829, 44020, 44210, 44400, 44588, 44776, 44963, 45149, 45334, 45519,
+    45703, 45886, 46069, 46250, 46431, 46612, 46791, 46970, 47149, 47326,
+    47503, 47679, 47855, 48030, 48204, 48378, 48551, 48723, 48895, 49067,
+    49237, 49407, 49577, 49746, 49914, 50082, 50249, 50416, 50582, 50747,
+    50912, 51077, 51241, 51404, 51567, 51730, 51892, 52053, 52214, 52374,
+    52534, 52694, 52853, 53011, 53169, 53327, 53484, 53640, 53797, 53952,
+    54108, 54262, 54417, 54571, 54724, 54877, 55030, 55182, 55334, 55485,
+    55636, 55787, 55937, 56087, 56236, 56385, 56534, 56682, 56830, 56977,
+    57124, 57271, 57417, 57563, 57709, 57854, 57999, 58143, 58287, 58431,
+    58574, 58717, 58860, 59002, 59144, 59286, 59427, 59568, 59709, 59849,
+    59989, 60129, 60268, 60407, 60546, 60684, 60822, 60960, 61098, 61235,
+    61372, 61508, 61644, 61780, 61916, 62051, 62186, 62321, 62456, 62590,
+    62724, 62857, 62991, 63124, 63256, 63389, 63521, 63653, 63785, 63916,
+    64047, 64178, 64309, 64439, 64569, 64699, 64828, 64957, 65086, 65215,
+    65344, 65472};
+
+// Floor of the square root of x, for x in [2^30, 2^32). The table estimate is
+// within 2^-9 of the root, and a Newton step from any positive estimate lands
+// at or just above the floor.
+static inline uint32_t FloorSqrtNormalized(uint32_t x) {
+  const uint32_t estimate = kSqrtLut[(x >> 24) - 64];
+  uint32_t res = (estimate + x / estimate) >> 1;
+  while ((uint64_t)res * res > x) {
+    --res;
+  }
+  return res;
+}
+
+static inline uint32_t FloorSqrt32(uint32_t num) {
+  const int shift = CountLeadingZeros32(num) & ~1;
+  return FloorSqrtNormalized(num << shift) >> (shift / 2);
+}
+
+// Floor of the square root of num, for num >= 2^32. The root of the top word
+// of the normalized value gives the top 16 bits, a Newton step from there the
+// low 16 bits, up to a small error that is corrected.
+static inline uint32_t FloorSqrt64(uint64_t num) {
+  const int shift = CountLeadingZeros64(num) & ~1;
+  const uint64_t x = num << shift;
+  const uint32_t high = FloorSqrtNormalized((uint32_t)(x >> 32));
+  const uint64_t remainder = x - (((uint64_t)high * high) << 32);
+  // The remainder is below (2 * high + 1) << 32, so the numerator fits in 32
+  // bits and the division needs no 64 bit library call. It is clamped rather
+  // than truncated, which keeps the estimate within a step of the root.
+  const uint64_t numerator = remainder >> 17;
+  const uint32_t step =
+      (numerator > 0xFFFFFFFF ? 0xFFFFFFFFU : (uint32_t)numerator) / high;
+  uint64_t res = ((uint64_t)high << 16) + step;
+  if (res > 0xFFFFFFFF) {
+    res = 0xFFFFFFFF;
+  }
+  while (res * res > x) {
+    --res;
+  }
+  while (res < 0xFFFFFFFF && (res + 1) * (res + 1) <= x) {
+    ++res;
+  }
+  return (uint32_t)(res >> (shift / 2));
+}
+
+// Same results as the bit by bit version below, including the rounding and the
+// 16 bit shortcut.
+static uint32_t Sqrt64(uint64_t num) {
+  if ((num >> 32) == 0) {
+    const uint32_t num32 = (uint32_t)num;
+    if (num32 == 0) {
+      return 0;
+    }
+    const uint32_t res = FloorSqrt32(num32);
+    // Do rounding - if we have the bits.
+    return (num32 - res * res > res && res != 0xFFFF) ? res + 1 : res;
+  }
+  const uint32_t res = FloorSqrt64(num);
+  return (num - (uint64_t)res * res > res && res != 0xFFFFFFFF) ? res + 1 : res;
+}
+#else
 static uint16_t Sqrt32(uint32_t num) {
   if (num == 0) {
     return 0;
@@ -117,6 +202,7 @@ static uint32_t Sqrt64(uint64_t num) {
   }
   return res;
 }
+#endif
 
 uint32_t* FilterbankSqrt(struct FilterbankState* state, int scale_down_shift) {
   const int num_channels = state->num_channels;
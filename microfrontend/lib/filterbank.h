@@ -26,6 +26,17 @@ This file has been modified by Silicon Labs.
 
 #define kFilterbankBits 12
 
+// Compute the square roots of FilterbankSqrt from a table estimate refined
+// with Newton steps, instead of bit by bit. Gives the same result, and needs a
+// hardware divider. Enabled by default on cores that have one, and on hosts.
+#ifndef FILTERBANK_FAST_SQRT
+#if defined(__ARM_FEATURE_IDIV) || !defined(__arm__)
+#define FILTERBANK_FAST_SQRT 1
+#else
+#define FILTERBANK_FAST_SQRT 0
+#endif
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -16,20 +16,39 @@ This file has been modified by Silicon Labs.
 ==============================================================================*/
 #include "microfrontend/lib/frontend.h"
 
+#include <string.h>
+
 #include "microfrontend/lib/bits.h"
 
-struct FrontendOutput FrontendProcessSamples(struct FrontendState* state,
-                                             const int16_t* samples,
-                                             size_t num_samples,
-                                             size_t* num_samples_read) {
-  struct FrontendOutput output;
-  output.values = NULL;
-  output.size = 0;
+// Try to apply the window. In ring buffer mode the gain, DC notch filter and
+// window of the new samples are fused in a single pass.
+static int FrontendWindowSamples(struct FrontendState* state,
+                                 const int16_t* samples, size_t num_samples,
+                                 size_t* num_samples_read) {
+  if (state->window.ring_buffer) {
+    return WindowProcessSamplesFused(&state->window, &state->dc_notch_filter,
+                                     samples, num_samples, num_samples_read);
+  }
+  return WindowProcessSamples(&state->window, &state->dc_notch_filter, samples,
+                              num_samples, num_samples_read);
+}
 
-  // Try to apply the window - if it fails, return and wait for more data.
-  if (!WindowProcessSamples(&state->window, &state->dc_notch_filter, samples, num_samples,
-                            num_samples_read)) {
-    return output;
+// Computes the features of the window's output and writes them to features,
+// or to the frontend's own output buffer when features is NULL.
+static const uint16_t* FrontendProcessWindow(struct FrontendState* state,
+                                             int correction_bits,
+                                             uint16_t* features) {
+  // Silent frames skip the FFT and filterbank, their features are the ones of
+  // the last processed silent frame.
+  if (state->energy_gate.enable_energy_gate &&
+      EnergyGateSkipFrame(&state->energy_gate, state->window.output,
+                          state->window.size)) {
+    if (features == NULL) {
+      return state->energy_gate.silence_output;
+    }
+    memcpy(features, state->energy_gate.silence_output,
+           state->energy_gate.output_size * sizeof(*features));
+    return features;
   }
 
   // Apply the FFT to the window's output (and scale it so that the fixed point
@@ -61,18 +80,92 @@ struct FrontendOutput FrontendProcessSamples(struct FrontendState* state,
     PcanGainControlApply(&state->pcan_gain_control, scaled_filterbank);
   }
 
-  // Apply the log and scale.
-  int correction_bits =
-      MostSignificantBit32(state->fft.fft_size) - 1 - (kFilterbankBits / 2);
-  uint16_t* logged_filterbank =
-      LogScaleApply(&state->log_scale, scaled_filterbank,
-                    state->filterbank.num_channels, correction_bits);
+  // Apply the log and scale. With the DCT enabled, the log scaled channels are
+  // kept in place as the input of the DCT.
+  uint16_t* logged_filterbank = (uint16_t*)scaled_filterbank;
+  if (!state->dct.enable_dct && features != NULL) {
+    logged_filterbank = features;
+  }
+  LogScaleApplyToBuffer(&state->log_scale, scaled_filterbank,
+                        state->filterbank.num_channels, correction_bits,
+                        logged_filterbank);
+  const uint16_t* output = logged_filterbank;
+
+  // Convert to cepstral coefficients.
+  if (state->dct.enable_dct) {
+    int16_t* coefficients =
+        (features != NULL) ? (int16_t*)features : state->dct.output;
+    DctApply(&state->dct, logged_filterbank, coefficients);
+    output = (const uint16_t*)coefficients;
+  }
+
+  if (state->energy_gate.enable_energy_gate) {
+    EnergyGateStoreFrame(&state->energy_gate, output);
+  }
+  return output;
+}
+
+static int FrontendCorrectionBits(const struct FrontendState* state) {
+  return MostSignificantBit32(state->fft.fft_size) - 1 - (kFilterbankBits / 2);
+}
+
+struct FrontendOutput FrontendProcessSamples(struct FrontendState* state,
+                                             const int16_t* samples,
+                                             size_t num_samples,
+                                             size_t* num_samples_read) {
+  struct FrontendOutput output;
+  output.values = NULL;
+  output.size = 0;
 
-  output.size = state->filterbank.num_channels;
-  output.values = logged_filterbank;
+  // If the window is not complete, return and wait for more data.
+  if (!FrontendWindowSamples(state, samples, num_samples, num_samples_read)) {
+    return output;
+  }
+
+  output.size = FrontendOutputSize(state);
+  output.values =
+      FrontendProcessWindow(state, FrontendCorrectionBits(state), NULL);
   return output;
 }
 
+int FrontendProcessSamplesBatch(struct FrontendState* state,
+                                const int16_t* samples, size_t num_samples,
+                                uint16_t* features, size_t features_size,
+                                size_t* features_index) {
+  const int correction_bits = FrontendCorrectionBits(state);
+  const size_t output_size = FrontendOutputSize(state);
+  size_t index = *features_index;
+  int frames = 0;
+
+  while (num_samples > 0) {
+    size_t num_samples_read;
+    const int window_ready =
+        FrontendWindowSamples(state, samples, num_samples, &num_samples_read);
+    samples += num_samples_read;
+    num_samples -= num_samples_read;
+    if (!window_ready) {
+      break;
+    }
+
+    FrontendProcessWindow(state, correction_bits, features + index);
+    index += output_size;
+    if (index >= features_size) {
+      index = 0;
+    }
+    ++frames;
+  }
+
+  *features_index = index;
+  return frames;
+}
+
+size_t FrontendOutputSize(const struct FrontendState* state) {
+  if (state->dct.enable_dct) {
+    return state->dct.num_coefficients;
+  }
+  return state->filterbank.num_channels;
+}
+
 void FrontendReset(struct FrontendState* state) {
   WindowReset(&state->window);
   sli_ml_fft_reset(&state->fft);
@@ -80,4 +173,7 @@ void FrontendReset(struct FrontendState* state) {
   NoiseReductionReset(&state->noise_reduction);
   DcNotchFilterReset(&state->dc_notch_filter);
   ActivityDetectionReset(&state->activity_detection);
+  if (state->energy_gate.enable_energy_gate) {
+    EnergyGateReset(&state->energy_gate);
+  }
 }
@@ -30,6 +30,9 @@ This file has been modified by Silicon Labs.
 #include "microfrontend/lib/window.h"
 #include "microfrontend/lib/activity_detection.h"
 #include "microfrontend/lib/dc_notch_filter.h"
+#include "microfrontend/lib/dct.h"
+#include "microfrontend/lib/energy_gate.h"
+#include "microfrontend/lib/frontend_tables.h"
 
 
 #ifdef __cplusplus
@@ -45,6 +48,10 @@ struct FrontendState {
   struct LogScaleState log_scale;
   struct ActivityDetectionState activity_detection;
   struct DcNotchFilterState dc_notch_filter;
+  struct DctState dct;
+  struct EnergyGateState energy_gate;
+  // Precomputed tables the state references instead of owning them, or NULL.
+  const struct FrontendTables* tables;
 };
 
 struct FrontendOutput {
@@ -58,12 +65,27 @@ struct FrontendOutput {
 // added to generate a feature vector, the returned size will be 0 and the
 // values pointer will be NULL. Note that the output pointer will be invalidated
 // as soon as FrontendProcessSamples is called again, so copy the contents
-// elsewhere if you need to use them later.
+// elsewhere if you need to use them later. When the DCT is enabled, the values
+// are int16 cepstral coefficients.
  struct FrontendOutput FrontendProcessSamples(struct FrontendState* state,
                                              const int16_t* samples,
                                              size_t num_samples,
                                              size_t* num_samples_read);
 
+// Processes all the samples, and writes the output of every complete frame to
+// the features ring buffer of features_size values, at *features_index which
+// is advanced past it. features_size must be a multiple of the number of
+// values per frame, see FrontendOutputSize. Samples left over after the last frame are kept for the
+// next call. Returns the number of frames written.
+ int FrontendProcessSamplesBatch(struct FrontendState* state,
+                                 const int16_t* samples, size_t num_samples,
+                                 uint16_t* features, size_t features_size,
+                                 size_t* features_index);
+
+ // Number of values per frame, the number of filterbank channels, or the number
+// of cepstral coefficients when the DCT is enabled.
+ size_t FrontendOutputSize(const struct FrontendState* state);
+
  void FrontendReset(struct FrontendState* state);
 
 #ifdef __cplusplus
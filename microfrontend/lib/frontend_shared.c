@@ -0,0 +1,131 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#include "microfrontend/lib/frontend_shared.h"
+
+#include "microfrontend/lib/bits.h"
+
+// Try to apply the window. In ring buffer mode the gain, DC notch filter and
+// window of the new samples are fused in a single pass.
+static int FrontendSharedWindowSamples(struct FrontendSharedState* state,
+                                       const int16_t* samples,
+                                       size_t num_samples,
+                                       size_t* num_samples_read) {
+  if (state->window.ring_buffer) {
+    return WindowProcessSamplesFused(&state->window, &state->dc_notch_filter,
+                                     samples, num_samples, num_samples_read);
+  }
+  return WindowProcessSamples(&state->window, &state->dc_notch_filter, samples,
+                              num_samples, num_samples_read);
+}
+
+// Converts the FFT bins used by any consumer to energy, in place. Every
+// consumer's filterbank then reads the same energy.
+static int32_t* FrontendSharedEnergy(struct FrontendSharedState* state) {
+  const struct complex_int16_t* fft_output = state->fft.output;
+  int32_t* energy = (int32_t*)state->fft.output;
+  int i;
+  for (i = state->start_index; i < state->end_index; ++i) {
+    const int32_t real = fft_output[i].real;
+    const int32_t imag = fft_output[i].imag;
+    energy[i] = (uint32_t)((real * real) + (imag * imag));
+  }
+  return energy;
+}
+
+// Computes the feature vector of a consumer from the shared energy, and
+// writes it to the consumer's ring buffer.
+static void FrontendConsumerProcess(struct FrontendConsumerState* consumer,
+                                    const int32_t* energy, int input_shift,
+                                    int correction_bits) {
+  FilterbankAccumulateChannels(&consumer->filterbank, energy);
+  uint32_t* scaled_filterbank =
+      FilterbankSqrt(&consumer->filterbank, input_shift);
+
+  if (consumer->noise_reduction.enable_noise_reduction) {
+    NoiseReductionApply(&consumer->noise_reduction, scaled_filterbank);
+  }
+
+  if (consumer->pcan_gain_control.enable_pcan) {
+    PcanGainControlApply(&consumer->pcan_gain_control, scaled_filterbank);
+  }
+
+  uint16_t* features = consumer->features + consumer->features_index;
+  uint16_t* logged_filterbank =
+      consumer->dct.enable_dct ? (uint16_t*)scaled_filterbank : features;
+  LogScaleApplyToBuffer(&consumer->log_scale, scaled_filterbank,
+                        consumer->filterbank.num_channels, correction_bits,
+                        logged_filterbank);
+  if (consumer->dct.enable_dct) {
+    DctApply(&consumer->dct, logged_filterbank, (int16_t*)features);
+  }
+
+  consumer->features_index += FrontendConsumerOutputSize(consumer);
+  if (consumer->features_index >= consumer->features_size) {
+    consumer->features_index = 0;
+  }
+}
+
+int FrontendSharedProcessSamples(struct FrontendSharedState* state,
+                                 const int16_t* samples, size_t num_samples) {
+  const int correction_bits =
+      MostSignificantBit32(state->fft.fft_size) - 1 - (kFilterbankBits / 2);
+  int frames = 0;
+
+  while (num_samples > 0) {
+    size_t num_samples_read;
+    const int window_ready = FrontendSharedWindowSamples(
+        state, samples, num_samples, &num_samples_read);
+    samples += num_samples_read;
+    num_samples -= num_samples_read;
+    if (!window_ready) {
+      break;
+    }
+
+    const int input_shift =
+        15 - MostSignificantBit32(state->window.max_abs_output_value);
+    sli_ml_fft_compute(&state->fft, state->window.output, input_shift);
+    const int32_t* energy = FrontendSharedEnergy(state);
+
+    int i;
+    for (i = 0; i < state->num_consumers; ++i) {
+      FrontendConsumerProcess(&state->consumers[i], energy, input_shift,
+                              correction_bits);
+    }
+    ++frames;
+  }
+  return frames;
+}
+
+size_t FrontendConsumerOutputSize(const struct FrontendConsumerState* consumer) {
+  if (consumer->dct.enable_dct) {
+    return consumer->dct.num_coefficients;
+  }
+  return consumer->filterbank.num_channels;
+}
+
+void FrontendSharedReset(struct FrontendSharedState* state) {
+  WindowReset(&state->window);
+  sli_ml_fft_reset(&state->fft);
+  DcNotchFilterReset(&state->dc_notch_filter);
+  int i;
+  for (i = 0; i < state->num_consumers; ++i) {
+    struct FrontendConsumerState* consumer = &state->consumers[i];
+    FilterbankReset(&consumer->filterbank);
+    NoiseReductionReset(&consumer->noise_reduction);
+    consumer->features_index = 0;
+  }
+}
@@ -0,0 +1,84 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#ifndef MICROFRONTEND_LIB_FRONTEND_SHARED_H_
+#define MICROFRONTEND_LIB_FRONTEND_SHARED_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "microfrontend/lib/utils.h"
+#include "inc/dsp/sl_ml_fft.h"
+#include "microfrontend/lib/filterbank.h"
+#include "microfrontend/lib/log_scale.h"
+#include "microfrontend/lib/noise_reduction.h"
+#include "microfrontend/lib/pcan_gain_control.h"
+#include "microfrontend/lib/window.h"
+#include "microfrontend/lib/dc_notch_filter.h"
+#include "microfrontend/lib/dct.h"
+
+#define kFrontendSharedMaxConsumers 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One set of features computed from the shared FFT, with its own filterbank,
+// noise reduction, gain control, log scale and DCT.
+struct FrontendConsumerState {
+  struct FilterbankState filterbank;
+  struct NoiseReductionState noise_reduction;
+  struct PcanGainControlState pcan_gain_control;
+  struct LogScaleState log_scale;
+  struct DctState dct;
+  // Ring buffer of feature vectors, features_index is where the next one is
+  // written.
+  uint16_t* features;
+  size_t features_size;
+  size_t features_index;
+};
+
+// A window and FFT feeding several consumers, so that the FFT of every frame
+// is computed once however many models use the audio.
+struct FrontendSharedState {
+  struct WindowState window;
+  struct DcNotchFilterState dc_notch_filter;
+  struct sli_ml_fft_state fft;
+  // Range of FFT bins used by at least one consumer.
+  int start_index;
+  int end_index;
+  int num_consumers;
+  struct FrontendConsumerState* consumers;
+};
+
+// Processes all the samples. For every complete frame, the window and FFT are
+// computed once, and every consumer writes its feature vector to its own ring
+// buffer. Samples left over after the last frame are kept for the next call.
+// Returns the number of frames processed.
+ int FrontendSharedProcessSamples(struct FrontendSharedState* state,
+                                  const int16_t* samples, size_t num_samples);
+
+// Number of values per feature vector of a consumer, the number of filterbank
+// channels, or the number of cepstral coefficients when the DCT is enabled.
+ size_t FrontendConsumerOutputSize(const struct FrontendConsumerState* consumer);
+
+ void FrontendSharedReset(struct FrontendSharedState* state);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // MICROFRONTEND_LIB_FRONTEND_SHARED_H_
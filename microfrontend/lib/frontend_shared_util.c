@@ -0,0 +1,174 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#include "microfrontend/lib/frontend_shared_util.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "microfrontend/lib/bits.h"
+
+void FrontendSharedFillConfigWithDefaults(struct FrontendSharedConfig* config) {
+  WindowFillConfigWithDefaults(&config->window);
+  DcNotchFilterFillConfigWithDefaults(&config->dc_notch_filter);
+  config->num_consumers = 1;
+  int i;
+  for (i = 0; i < kFrontendSharedMaxConsumers; ++i) {
+    FrontendConsumerFillConfigWithDefaults(&config->consumers[i]);
+  }
+}
+
+void FrontendConsumerFillConfigWithDefaults(
+    struct FrontendConsumerConfig* config) {
+  FilterbankFillConfigWithDefaults(&config->filterbank);
+  NoiseReductionFillConfigWithDefaults(&config->noise_reduction);
+  PcanGainControlFillConfigWithDefaults(&config->pcan_gain_control);
+  LogScaleFillConfigWithDefaults(&config->log_scale);
+  DctFillConfigWithDefaults(&config->dct);
+  config->num_frames = 49;
+}
+
+static int FrontendConsumerPopulateState(
+    const struct FrontendConsumerConfig* config,
+    struct FrontendConsumerState* state, int sample_rate, int spectrum_size,
+    int input_correction_bits) {
+  if (!config->noise_reduction.enable_noise_reduction &&
+      config->pcan_gain_control.enable_pcan) {
+    fprintf(stderr, "PCAN must be disabled if noise reduction is disabled");
+    return 0;
+  }
+
+  if (!FilterbankPopulateState(&config->filterbank, &state->filterbank,
+                               sample_rate, spectrum_size)) {
+    fprintf(stderr, "Failed to populate filterbank state\n");
+    return 0;
+  }
+
+  if (!NoiseReductionPopulateState(&config->noise_reduction,
+                                   &state->noise_reduction,
+                                   state->filterbank.num_channels)) {
+    fprintf(stderr, "Failed to populate noise reduction state\n");
+    return 0;
+  }
+
+  if (!PcanGainControlPopulateState(
+          &config->pcan_gain_control, &state->pcan_gain_control,
+          state->noise_reduction.estimate, state->filterbank.num_channels,
+          state->noise_reduction.smoothing_bits, input_correction_bits)) {
+    fprintf(stderr, "Failed to populate pcan gain control state\n");
+    return 0;
+  }
+
+  if (!LogScalePopulateState(&config->log_scale, &state->log_scale)) {
+    fprintf(stderr, "Failed to populate log scale state\n");
+    return 0;
+  }
+
+  if (!DctPopulateState(&config->dct, &state->dct,
+                        state->filterbank.num_channels)) {
+    fprintf(stderr, "Failed to populate DCT state\n");
+    return 0;
+  }
+
+  if (config->num_frames < 1) {
+    fprintf(stderr, "Number of feature vectors must be at least 1\n");
+    return 0;
+  }
+  state->features_size =
+      config->num_frames * FrontendConsumerOutputSize(state);
+  state->features =
+      (uint16_t*)calloc(state->features_size, sizeof(*state->features));
+  if (state->features == NULL) {
+    fprintf(stderr, "Failed to allocate consumer features buffer\n");
+    return 0;
+  }
+  return 1;
+}
+
+int FrontendSharedPopulateState(const struct FrontendSharedConfig* config,
+                                struct FrontendSharedState* state,
+                                int sample_rate) {
+  memset(state, 0, sizeof(*state));
+
+  if (config->num_consumers < 1 ||
+      config->num_consumers > kFrontendSharedMaxConsumers) {
+    fprintf(stderr, "Number of consumers must be 1 to %d\n",
+            kFrontendSharedMaxConsumers);
+    return 0;
+  }
+
+  if (!WindowPopulateState(&config->window, &state->window, sample_rate)) {
+    fprintf(stderr, "Failed to populate window state\n");
+    return 0;
+  }
+
+  if (sli_ml_fft_init(&state->fft, state->window.size) != SL_STATUS_OK) {
+    fprintf(stderr, "Failed to initialize FFT\n");
+    return 0;
+  }
+
+  DcNotchFilterConfig(&config->dc_notch_filter, &state->dc_notch_filter);
+
+  state->consumers = (struct FrontendConsumerState*)calloc(
+      config->num_consumers, sizeof(*state->consumers));
+  if (state->consumers == NULL) {
+    fprintf(stderr, "Failed to allocate consumer states\n");
+    return 0;
+  }
+  state->num_consumers = config->num_consumers;
+
+  const int input_correction_bits =
+      MostSignificantBit32(state->fft.fft_size) - 1 - (kFilterbankBits / 2);
+  int i;
+  for (i = 0; i < state->num_consumers; ++i) {
+    struct FrontendConsumerState* consumer = &state->consumers[i];
+    if (!FrontendConsumerPopulateState(&config->consumers[i], consumer,
+                                       sample_rate, state->fft.fft_size / 2 + 1,
+                                       input_correction_bits)) {
+      return 0;
+    }
+    if (i == 0 || consumer->filterbank.start_index < state->start_index) {
+      state->start_index = consumer->filterbank.start_index;
+    }
+    if (i == 0 || consumer->filterbank.end_index > state->end_index) {
+      state->end_index = consumer->filterbank.end_index;
+    }
+  }
+
+  FrontendSharedReset(state);
+
+  // All good, return a true value.
+  return 1;
+}
+
+void FrontendSharedFreeStateContents(struct FrontendSharedState* state) {
+  WindowFreeStateContents(&state->window);
+  sli_ml_fft_deinit(&state->fft);
+  if (state->consumers != NULL) {
+    int i;
+    for (i = 0; i < state->num_consumers; ++i) {
+      struct FrontendConsumerState* consumer = &state->consumers[i];
+      FilterbankFreeStateContents(&consumer->filterbank);
+      NoiseReductionFreeStateContents(&consumer->noise_reduction);
+      PcanGainControlFreeStateContents(&consumer->pcan_gain_control);
+      DctFreeStateContents(&consumer->dct);
+      free(consumer->features);
+    }
+    free(state->consumers);
+    state->consumers = NULL;
+  }
+  state->num_consumers = 0;
+}
@@ -0,0 +1,70 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#ifndef MICROFRONTEND_LIB_FRONTEND_SHARED_UTIL_H_
+#define MICROFRONTEND_LIB_FRONTEND_SHARED_UTIL_H_
+
+#include "microfrontend/lib/utils.h"
+#include "microfrontend/lib/filterbank_util.h"
+#include "microfrontend/lib/frontend_shared.h"
+#include "microfrontend/lib/log_scale_util.h"
+#include "microfrontend/lib/noise_reduction_util.h"
+#include "microfrontend/lib/pcan_gain_control_util.h"
+#include "microfrontend/lib/window_util.h"
+#include "microfrontend/lib/dc_notch_filter_util.h"
+#include "microfrontend/lib/dct_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct FrontendConsumerConfig {
+  struct FilterbankConfig filterbank;
+  struct NoiseReductionConfig noise_reduction;
+  struct PcanGainControlConfig pcan_gain_control;
+  struct LogScaleConfig log_scale;
+  struct DctConfig dct;
+  // number of feature vectors in the ring buffer of the consumer
+  int num_frames;
+};
+
+struct FrontendSharedConfig {
+  struct WindowConfig window;
+  struct DcNotchFilterConfig dc_notch_filter;
+  int num_consumers;
+  struct FrontendConsumerConfig consumers[kFrontendSharedMaxConsumers];
+};
+
+// Fills the FrontendSharedConfig with "sane" defaults, and a single consumer.
+ void FrontendSharedFillConfigWithDefaults(struct FrontendSharedConfig* config);
+
+// Fills the FrontendConsumerConfig with "sane" defaults.
+ void FrontendConsumerFillConfigWithDefaults(
+    struct FrontendConsumerConfig* config);
+
+// Allocates any buffers.
+ int FrontendSharedPopulateState(const struct FrontendSharedConfig* config,
+                                struct FrontendSharedState* state,
+                                int sample_rate);
+
+// Frees any allocated buffers.
+ void FrontendSharedFreeStateContents(struct FrontendSharedState* state);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // MICROFRONTEND_LIB_FRONTEND_SHARED_UTIL_H_
@@ -0,0 +1,68 @@
+/* Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file has been modified by Silicon Labs.
+==============================================================================*/
+#ifndef MICROFRONTEND_LIB_FRONTEND_TABLES_H_
+#define MICROFRONTEND_LIB_FRONTEND_TABLES_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Precomputed tables of a frontend configuration, generated as const arrays
+// by tool/frontend/generate_frontend_tables.py so that they can stay in
+// flash. See FrontendPopulateStateFromTables.
+struct FrontendTables {
+  // Configuration the tables were generated for. It must match the one the
+  // state is populated with.
+  int sample_rate;
+  int window_size_ms;
+  int num_channels;
+  float lower_band_limit;
+  float upper_band_limit;
+  int enable_pcan;
+  float pcan_strength;
+  float pcan_offset;
+  int pcan_gain_bits;
+  int noise_reduction_smoothing_bits;
+  // 0 when the DCT is disabled
+  int num_dct_coefficients;
+
+  int window_size;
+  int fft_size;
+  const int16_t* window_coefficients;
+
+  int filterbank_start_index;
+  int filterbank_end_index;
+  const int16_t* channel_frequency_starts;
+  const int16_t* channel_weight_starts;
+  const int16_t* channel_widths;
+  const int16_t* weights;
+  const int16_t* unweights;
+
+  // NULL when PCAN is disabled
+  const int16_t* pcan_gain_lut;
+  // NULL when the DCT is disabled
+  const int16_t* dct_cosines;
+};
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // MICROFRONTEND_LIB_FRONTEND_TABLES_H_
@@ -29,10 +29,114 @@ void FrontendFillConfigWithDefaults(struct FrontendConfig* config) {
   LogScaleFillConfigWithDefaults(&config->log_scale);
   ActivityDetectionFillConfigWithDefaults(&config->activity_detection);
   DcNotchFilterFillConfigWithDefaults(&config->dc_notch_filter);
+  DctFillConfigWithDefaults(&config->dct);
+  EnergyGateFillConfigWithDefaults(&config->energy_gate);
 }
 
-int FrontendPopulateState(const struct FrontendConfig* config,
-                          struct FrontendState* state, int sample_rate) {
+// The table referencing counterparts of the module populate functions.
+static int WindowReferenceTables(const struct WindowConfig* config,
+                                 const struct FrontendTables* tables,
+                                 struct WindowState* state, int sample_rate) {
+  state->size = tables->window_size;
+  state->step = config->step_size_ms * sample_rate / 1000;
+  state->input_gain = config->input_gain;
+  state->coefficients = (int16_t*)tables->window_coefficients;
+  state->input_used = 0;
+  state->ring_buffer = config->ring_buffer;
+  state->input_start = 0;
+  state->input = malloc(state->size * sizeof(*state->input));
+  state->output = malloc(state->size * sizeof(*state->output));
+  if (state->input == NULL || state->output == NULL) {
+    fprintf(stderr, "Failed to allocate window buffers\n");
+    return 0;
+  }
+  return 1;
+}
+
+static int FilterbankReferenceTables(const struct FrontendTables* tables,
+                                     struct FilterbankState* state) {
+  state->num_channels = tables->num_channels;
+  state->start_index = tables->filterbank_start_index;
+  state->end_index = tables->filterbank_end_index;
+  state->channel_frequency_starts = (int16_t*)tables->channel_frequency_starts;
+  state->channel_weight_starts = (int16_t*)tables->channel_weight_starts;
+  state->channel_widths = (int16_t*)tables->channel_widths;
+  state->weights = (int16_t*)tables->weights;
+  state->unweights = (int16_t*)tables->unweights;
+  state->work = malloc((state->num_channels + 1) * sizeof(*state->work));
+  if (state->work == NULL) {
+    fprintf(stderr, "Failed to allocate filterbank work buffer\n");
+    return 0;
+  }
+  return 1;
+}
+
+static void PcanGainControlReferenceTables(
+    const struct PcanGainControlConfig* config,
+    const struct FrontendTables* tables, struct PcanGainControlState* state,
+    uint32_t* noise_estimate, int num_channels, int input_correction_bits) {
+  state->enable_pcan = config->enable_pcan;
+  if (!state->enable_pcan) {
+    return;
+  }
+  state->noise_estimate = noise_estimate;
+  state->num_channels = num_channels;
+  state->gain_lut = (int16_t*)tables->pcan_gain_lut;
+  state->snr_shift = config->gain_bits - input_correction_bits - kPcanSnrBits;
+}
+
+static int DctReferenceTables(const struct DctConfig* config,
+                              const struct FrontendTables* tables,
+                              struct DctState* state, int num_channels) {
+  state->enable_dct = config->enable_dct;
+  state->num_channels = num_channels;
+  state->num_coefficients = config->num_coefficients;
+  state->cosines = NULL;
+  state->output = NULL;
+  if (!state->enable_dct) {
+    return 1;
+  }
+  state->cosines = (int16_t*)tables->dct_cosines;
+  state->output =
+      (int16_t*)malloc(state->num_coefficients * sizeof(*state->output));
+  if (state->output == NULL) {
+    fprintf(stderr, "Failed to allocate DCT buffers\n");
+    return 0;
+  }
+  return 1;
+}
+
+static int FrontendTablesMatchConfig(const struct FrontendConfig* config,
+                                     const struct FrontendTables* tables,
+                                     int sample_rate) {
+  if (tables->sample_rate != sample_rate ||
+      tables->window_size_ms < 0 ||
+      (size_t)tables->window_size_ms != config->window.size_ms ||
+      tables->num_channels != config->filterbank.num_channels ||
+      tables->lower_band_limit != config->filterbank.lower_band_limit ||
+      tables->upper_band_limit != config->filterbank.upper_band_limit) {
+    return 0;
+  }
+  if (tables->enable_pcan != config->pcan_gain_control.enable_pcan) {
+    return 0;
+  }
+  if (tables->enable_pcan &&
+      (tables->pcan_strength != config->pcan_gain_control.strength ||
+       tables->pcan_offset != config->pcan_gain_control.offset ||
+       tables->pcan_gain_bits != config->pcan_gain_control.gain_bits ||
+       tables->noise_reduction_smoothing_bits !=
+           config->noise_reduction.smoothing_bits)) {
+    return 0;
+  }
+  const int num_dct_coefficients =
+      config->dct.enable_dct ? config->dct.num_coefficients : 0;
+  return tables->num_dct_coefficients == num_dct_coefficients;
+}
+
+// Populates the state, computing the tables when tables is NULL.
+static int FrontendPopulate(const struct FrontendConfig* config,
+                            const struct FrontendTables* tables,
+                            struct FrontendState* state, int sample_rate) {
 
   if(!config->noise_reduction.enable_noise_reduction && config->pcan_gain_control.enable_pcan)
   {
@@ -42,7 +146,19 @@ int FrontendPopulateState(const struct FrontendConfig* config,
 
   memset(state, 0, sizeof(*state));
 
-  if (!WindowPopulateState(&config->window, &state->window, sample_rate)) {
+  if (tables != NULL) {
+    if (!FrontendTablesMatchConfig(config, tables, sample_rate)) {
+      fprintf(stderr, "Frontend tables do not match the configuration\n");
+      return 0;
+    }
+    state->tables = tables;
+  }
+
+  if (tables != NULL
+          ? !WindowReferenceTables(&config->window, tables, &state->window,
+                                   sample_rate)
+          : !WindowPopulateState(&config->window, &state->window,
+                                 sample_rate)) {
     fprintf(stderr, "Failed to populate window state\n");
     return 0;
   }
@@ -52,8 +168,15 @@ int FrontendPopulateState(const struct FrontendConfig* config,
     return 0;
   }
 
-  if (!FilterbankPopulateState(&config->filterbank, &state->filterbank,
-                               sample_rate, state->fft.fft_size / 2 + 1)) {
+  if (tables != NULL && tables->fft_size != (int)state->fft.fft_size) {
+    fprintf(stderr, "Frontend tables do not match the FFT size\n");
+    return 0;
+  }
+
+  if (tables != NULL
+          ? !FilterbankReferenceTables(tables, &state->filterbank)
+          : !FilterbankPopulateState(&config->filterbank, &state->filterbank,
+                                     sample_rate, state->fft.fft_size / 2 + 1)) {
     fprintf(stderr, "Failed to populate filterbank state\n");
     return 0;
   }
@@ -70,10 +193,17 @@ int FrontendPopulateState(const struct FrontendConfig* config,
   DcNotchFilterConfig(&config->dc_notch_filter, &state->dc_notch_filter);
   int input_correction_bits =
       MostSignificantBit32(state->fft.fft_size) - 1 - (kFilterbankBits / 2);
-  if (!PcanGainControlPopulateState(
-          &config->pcan_gain_control, &state->pcan_gain_control,
-          state->noise_reduction.estimate, state->filterbank.num_channels,
-          state->noise_reduction.smoothing_bits, input_correction_bits)) {
+  if (tables != NULL) {
+    PcanGainControlReferenceTables(
+        &config->pcan_gain_control, tables, &state->pcan_gain_control,
+        state->noise_reduction.estimate, state->filterbank.num_channels,
+        input_correction_bits);
+  } else if (!PcanGainControlPopulateState(
+                 &config->pcan_gain_control, &state->pcan_gain_control,
+                 state->noise_reduction.estimate,
+                 state->filterbank.num_channels,
+                 state->noise_reduction.smoothing_bits,
+                 input_correction_bits)) {
     fprintf(stderr, "Failed to populate pcan gain control state\n");
     return 0;
   }
@@ -83,16 +213,57 @@ int FrontendPopulateState(const struct FrontendConfig* config,
     return 0;
   }
 
+  if (tables != NULL
+          ? !DctReferenceTables(&config->dct, tables, &state->dct,
+                                state->filterbank.num_channels)
+          : !DctPopulateState(&config->dct, &state->dct,
+                              state->filterbank.num_channels)) {
+    fprintf(stderr, "Failed to populate DCT state\n");
+    return 0;
+  }
+
+  if (!EnergyGatePopulateState(&config->energy_gate, &state->energy_gate,
+                               state->window.size, FrontendOutputSize(state))) {
+    fprintf(stderr, "Failed to populate energy gate state\n");
+    return 0;
+  }
+
   FrontendReset(state);
 
   // All good, return a true value.
   return 1;
 }
 
+int FrontendPopulateState(const struct FrontendConfig* config,
+                          struct FrontendState* state, int sample_rate) {
+  return FrontendPopulate(config, NULL, state, sample_rate);
+}
+
+int FrontendPopulateStateFromTables(const struct FrontendConfig* config,
+                                    const struct FrontendTables* tables,
+                                    struct FrontendState* state,
+                                    int sample_rate) {
+  return FrontendPopulate(config, tables, state, sample_rate);
+}
+
 void FrontendFreeStateContents(struct FrontendState* state) {
+  if (state->tables != NULL) {
+    // The tables are not owned by the state.
+    state->window.coefficients = NULL;
+    state->filterbank.channel_frequency_starts = NULL;
+    state->filterbank.channel_weight_starts = NULL;
+    state->filterbank.channel_widths = NULL;
+    state->filterbank.weights = NULL;
+    state->filterbank.unweights = NULL;
+    state->pcan_gain_control.gain_lut = NULL;
+    state->dct.cosines = NULL;
+    state->tables = NULL;
+  }
   WindowFreeStateContents(&state->window);
   sli_ml_fft_deinit(&state->fft);
   FilterbankFreeStateContents(&state->filterbank);
   NoiseReductionFreeStateContents(&state->noise_reduction);
   PcanGainControlFreeStateContents(&state->pcan_gain_control);
+  DctFreeStateContents(&state->dct);
+  EnergyGateFreeStateContents(&state->energy_gate);
 }
@@ -26,6 +26,8 @@ This file has been modified by Silicon Labs.
 #include "microfrontend/lib/window_util.h"
 #include "microfrontend/lib/activity_detection_util.h"
 #include "microfrontend/lib/dc_notch_filter_util.h"
+#include "microfrontend/lib/dct_util.h"
+#include "microfrontend/lib/energy_gate_util.h"
 
 
 #ifdef __cplusplus
@@ -40,6 +42,8 @@ struct FrontendConfig {
   struct LogScaleConfig log_scale;
   struct ActivityDetectionConfig activity_detection;
   struct DcNotchFilterConfig dc_notch_filter;
+  struct DctConfig dct;
+  struct EnergyGateConfig energy_gate;
 };
 
 // Fills the frontendConfig with "sane" defaults.
@@ -49,6 +53,15 @@ struct FrontendConfig {
  int FrontendPopulateState(const struct FrontendConfig* config,
                           struct FrontendState* state, int sample_rate);
 
+// Same as FrontendPopulateState, but references the window, filterbank, PCAN
+// and DCT tables in place instead of allocating and computing them. The tables
+// must have been generated for the same configuration and sample rate, and
+// outlive the state. Only the buffers written while processing are allocated.
+ int FrontendPopulateStateFromTables(const struct FrontendConfig* config,
+                                    const struct FrontendTables* tables,
+                                    struct FrontendState* state,
+                                    int sample_rate);
+
 // Frees any allocated buffers.
  void FrontendFreeStateContents(struct FrontendState* state);
 
@@ -29,13 +29,10 @@ This file has been modified by Silicon Labs.
 // logarithm.
 
 static uint32_t Log2FractionPart(const uint32_t x, const uint32_t log2x) {
-  // Part 1
-  int32_t frac = x - (1LL << log2x);
-  if (log2x < kLogScaleLog2) {
-    frac <<= kLogScaleLog2 - log2x;
-  } else {
-    frac >>= log2x - kLogScaleLog2;
-  }
+  // Part 1, the bits below the leading one are aligned to kLogScaleLog2 bits
+  // by normalizing the leading one to bit 31 and dropping it. This is the same
+  // as shifting them left or right depending on log2x, without the branch.
+  const int32_t frac = (x << (31 - log2x) << 1) >> (32 - kLogScaleLog2);
   // Part 2
   const uint32_t base_seg = frac >> (kLogScaleLog2 - kLogSegmentsLog2);
   const uint32_t seg_unit =
@@ -59,27 +56,36 @@ static uint32_t Log(const uint32_t x, const uint32_t scale_shift) {
   return loge_scaled;
 }
 
-uint16_t* LogScaleApply(struct LogScaleState* state, uint32_t* signal,
-                        int signal_size, int correction_bits) {
+void LogScaleApplyToBuffer(struct LogScaleState* state, const uint32_t* signal,
+                           int signal_size, int correction_bits,
+                           uint16_t* output) {
   const int scale_shift = state->scale_shift;
-  uint16_t* output = (uint16_t*)signal;
-  uint16_t* ret = output;
   int i;
-  for (i = 0; i < signal_size; ++i) {
-    uint32_t value = *signal++;
-    if (state->enable_log) {
-      if (correction_bits < 0) {
-        value >>= -correction_bits;
-      } else {
-        value <<= correction_bits;
-      }
-      if (value > 1) {
-        value = Log(value, scale_shift);
-      } else {
-        value = 0;
-      }
+  if (!state->enable_log) {
+    for (i = 0; i < signal_size; ++i) {
+      const uint32_t value = *signal++;
+      *output++ = (value < kuint16max) ? value : kuint16max;
     }
-    *output++ = (value < kuint16max) ? value : kuint16max;
+    return;
   }
-  return ret;
+
+  // One of the shifts is zero, the loop below doesn't branch on the sign of
+  // the correction.
+  const int right_shift = correction_bits < 0 ? -correction_bits : 0;
+  const int left_shift = correction_bits < 0 ? 0 : correction_bits;
+  for (i = 0; i < signal_size; ++i) {
+    const uint32_t value = (*signal++ >> right_shift) << left_shift;
+    // Values of 0 and 1 give 0. The logarithm is computed for all values and
+    // discarded for those, so that they are a select instead of a branch.
+    const uint32_t log_value = Log(value > 1 ? value : 2, scale_shift);
+    const uint32_t result = value > 1 ? log_value : 0;
+    *output++ = (result < kuint16max) ? result : kuint16max;
+  }
+}
+
+uint16_t* LogScaleApply(struct LogScaleState* state, uint32_t* signal,
+                        int signal_size, int correction_bits) {
+  uint16_t* output = (uint16_t*)signal;
+  LogScaleApplyToBuffer(state, signal, signal_size, correction_bits, output);
+  return output;
 }
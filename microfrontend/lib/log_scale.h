@@ -36,6 +36,12 @@ struct LogScaleState {
  uint16_t* LogScaleApply(struct LogScaleState* state, uint32_t* signal,
                         int signal_size, int correction_bits);
 
+// Same as LogScaleApply, but writes the 16 bit values to output, which can be
+// the signal array.
+ void LogScaleApplyToBuffer(struct LogScaleState* state, const uint32_t* signal,
+                           int signal_size, int correction_bits,
+                           uint16_t* output);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -19,42 +19,59 @@ This file has been modified by Silicon Labs.
 
 #include <string.h>
 
-int WindowProcessSamples(struct WindowState* state, struct DcNotchFilterState *dc_notch_filter_state, const int16_t* samples,
-                         size_t num_samples, size_t* num_samples_read) {
-  const int size = state->size;
-
-  // Copy samples from the samples buffer over to our local input.
-  size_t max_samples_to_copy = state->size - state->input_used;
-  if (max_samples_to_copy > num_samples) {
-    max_samples_to_copy = num_samples;
-  }
+// One output of DcNotchFilterProcessSamples.
+static inline int16_t DcNotchFilterSample(int16_t coef, int16_t in,
+                                          int16_t prev_in, int16_t prev_out) {
+  const int16_t d = in - prev_in;
+  const int32_t p = coef * prev_out;
+  const int16_t sum = d + (((p >> 14) + 1) >> 1);
+  return sum;
+}
 
-  if(dc_notch_filter_state != NULL && dc_notch_filter_state->enable_dc_notch_filter) {
+static void CopySamples(const struct WindowState* state,
+                        struct DcNotchFilterState *dc_notch_filter_state,
+                        const int16_t* samples, int16_t* input,
+                        size_t num_samples) {
+  const int gain = state->input_gain;
+  const int dc_notch = dc_notch_filter_state != NULL &&
+                       dc_notch_filter_state->enable_dc_notch_filter;
+  if (gain != 1 && num_samples > 0) {
+    size_t i;
+    if (dc_notch) {
+      const int16_t coef = dc_notch_filter_state->dc_notch_coef;
+      int16_t prev_in = dc_notch_filter_state->prev_in;
+      int16_t prev_out = dc_notch_filter_state->prev_out;
+      for (i = 0; i < num_samples; ++i) {
+        const int16_t value = samples[i] * gain;
+        prev_out = DcNotchFilterSample(coef, value, prev_in, prev_out);
+        prev_in = value;
+        input[i] = prev_out;
+      }
+      dc_notch_filter_state->prev_in = prev_in;
+      dc_notch_filter_state->prev_out = prev_out;
+    } else {
+      for (i = 0; i < num_samples; ++i) {
+        input[i] = samples[i] * gain;
+      }
+    }
+  } else if(dc_notch) {
     DcNotchFilterProcessSamples(
       dc_notch_filter_state, 
-      samples, state->input + state->input_used,
-      max_samples_to_copy
+      samples, input,
+      num_samples
     );
   } else {
-    memcpy(state->input + state->input_used, samples,
-          max_samples_to_copy * sizeof(*samples));
-  }
-
-  *num_samples_read = max_samples_to_copy;
-  state->input_used += max_samples_to_copy;
-
-  if (state->input_used < state->size) {
-    // We don't have enough samples to compute a window.
-    return 0;
+    memcpy(input, samples, num_samples * sizeof(*samples));
   }
+}
 
-  // Apply the window to the input.
-  const int16_t* coefficients = state->coefficients;
-  const int16_t* input = state->input;
-  int16_t* output = state->output;
+// Applies the window coefficients to count input samples, and returns the
+// larger of max_abs_output_value and the largest absolute output.
+static int16_t ApplyWindow(const int16_t* input, const int16_t* coefficients,
+                           int16_t* output, int count,
+                           int16_t max_abs_output_value) {
   int i;
-  int16_t max_abs_output_value = 0;
-  for (i = 0; i < size; ++i) {
+  for (i = 0; i < count; ++i) {
     int16_t new_value =
         (((int32_t)*input++) * *coefficients++) >> kFrontendWindowBits;
     *output++ = new_value;
@@ -65,6 +82,204 @@ int WindowProcessSamples(struct WindowState* state, struct DcNotchFilterState *d
       max_abs_output_value = new_value;
     }
   }
+  return max_abs_output_value;
+}
+
+// Applies the gain and the DC notch filter to count samples, stores them in
+// the input, and applies the window coefficients to them. Returns the larger
+// of max_abs_output_value and the largest absolute output.
+static int16_t PreprocessSamples(const struct WindowState* state,
+                                 struct DcNotchFilterState *dc_notch_filter_state,
+                                 const int16_t* samples, int16_t* input,
+                                 const int16_t* coefficients, int16_t* output,
+                                 int count, int16_t max_abs_output_value) {
+  if (count <= 0) {
+    return max_abs_output_value;
+  }
+  const int gain = state->input_gain;
+  const int dc_notch = dc_notch_filter_state != NULL &&
+                       dc_notch_filter_state->enable_dc_notch_filter;
+  int16_t coef = 0;
+  int16_t prev_in = 0;
+  int16_t prev_out = 0;
+  if (dc_notch) {
+    coef = dc_notch_filter_state->dc_notch_coef;
+    prev_in = dc_notch_filter_state->prev_in;
+    prev_out = dc_notch_filter_state->prev_out;
+  }
+  int i;
+  for (i = 0; i < count; ++i) {
+    int16_t value = samples[i] * gain;
+    if (dc_notch) {
+      prev_out = DcNotchFilterSample(coef, value, prev_in, prev_out);
+      prev_in = value;
+      value = prev_out;
+    }
+    input[i] = value;
+    int16_t new_value =
+        (((int32_t)value) * coefficients[i]) >> kFrontendWindowBits;
+    output[i] = new_value;
+    if (new_value < 0) {
+      new_value = -new_value;
+    }
+    if (new_value > max_abs_output_value) {
+      max_abs_output_value = new_value;
+    }
+  }
+  if (dc_notch) {
+    dc_notch_filter_state->prev_in = prev_in;
+    dc_notch_filter_state->prev_out = prev_out;
+  }
+  return max_abs_output_value;
+}
+
+static int WindowProcessSamplesRing(struct WindowState* state,
+                                    struct DcNotchFilterState *dc_notch_filter_state,
+                                    const int16_t* samples, size_t num_samples,
+                                    size_t* num_samples_read) {
+  const size_t size = state->size;
+  size_t max_samples_to_copy = size - state->input_used;
+  if (max_samples_to_copy > num_samples) {
+    max_samples_to_copy = num_samples;
+  }
+
+  // Copy the samples behind the newest one, wrapping around the end of the
+  // input.
+  size_t end = state->input_start + state->input_used;
+  if (end >= size) {
+    end -= size;
+  }
+  size_t first = size - end;
+  if (first > max_samples_to_copy) {
+    first = max_samples_to_copy;
+  }
+  if (first > 0) {
+    CopySamples(state, dc_notch_filter_state, samples, state->input + end, first);
+  }
+  if (max_samples_to_copy > first) {
+    CopySamples(state, dc_notch_filter_state, samples + first, state->input,
+                max_samples_to_copy - first);
+  }
+  *num_samples_read = max_samples_to_copy;
+  state->input_used += max_samples_to_copy;
+
+  if (state->input_used < size) {
+    // We don't have enough samples to compute a window.
+    return 0;
+  }
+
+  // Apply the window to the oldest samples up to the end of the input, then
+  // to the wrapped around samples.
+  const size_t start = state->input_start;
+  int16_t max_abs_output_value =
+      ApplyWindow(state->input + start, state->coefficients, state->output,
+                  size - start, 0);
+  max_abs_output_value =
+      ApplyWindow(state->input, state->coefficients + (size - start),
+                  state->output + (size - start), start, max_abs_output_value);
+
+  // Drop the oldest step size samples by advancing the start.
+  state->input_start += state->step;
+  if (state->input_start >= size) {
+    state->input_start -= size;
+  }
+  state->input_used -= state->step;
+  state->max_abs_output_value = max_abs_output_value;
+
+  // Indicate that the output buffer is valid for the next stage.
+  return 1;
+}
+
+int WindowProcessSamplesFused(struct WindowState* state, struct DcNotchFilterState *dc_notch_filter_state,
+                              const int16_t* samples, size_t num_samples,
+                              size_t* num_samples_read) {
+  const size_t size = state->size;
+  size_t max_samples_to_copy = size - state->input_used;
+  if (max_samples_to_copy > num_samples) {
+    max_samples_to_copy = num_samples;
+  }
+  *num_samples_read = max_samples_to_copy;
+
+  if (state->input_used + max_samples_to_copy < size) {
+    // We don't have enough samples to compute a window, only store them.
+    return WindowProcessSamplesRing(state, dc_notch_filter_state, samples,
+                                    num_samples, num_samples_read);
+  }
+
+  // Apply the window to the samples already in the input, the oldest first.
+  const size_t start = state->input_start;
+  const size_t used = state->input_used;
+  size_t first = size - start;
+  if (first > used) {
+    first = used;
+  }
+  int16_t max_abs_output_value =
+      ApplyWindow(state->input + start, state->coefficients, state->output,
+                  first, 0);
+  max_abs_output_value =
+      ApplyWindow(state->input, state->coefficients + first,
+                  state->output + first, used - first, max_abs_output_value);
+
+  // Then preprocess the new samples completing the window, wrapping around the
+  // end of the input.
+  size_t end = start + used;
+  if (end >= size) {
+    end -= size;
+  }
+  size_t new_first = size - end;
+  if (new_first > max_samples_to_copy) {
+    new_first = max_samples_to_copy;
+  }
+  max_abs_output_value =
+      PreprocessSamples(state, dc_notch_filter_state, samples,
+                        state->input + end, state->coefficients + used,
+                        state->output + used, new_first, max_abs_output_value);
+  max_abs_output_value =
+      PreprocessSamples(state, dc_notch_filter_state, samples + new_first,
+                        state->input, state->coefficients + used + new_first,
+                        state->output + used + new_first,
+                        max_samples_to_copy - new_first, max_abs_output_value);
+
+  // Drop the oldest step size samples by advancing the start.
+  state->input_start += state->step;
+  if (state->input_start >= size) {
+    state->input_start -= size;
+  }
+  state->input_used = size - state->step;
+  state->max_abs_output_value = max_abs_output_value;
+
+  // Indicate that the output buffer is valid for the next stage.
+  return 1;
+}
+
+int WindowProcessSamples(struct WindowState* state, struct DcNotchFilterState *dc_notch_filter_state, const int16_t* samples,
+                         size_t num_samples, size_t* num_samples_read) {
+  if (state->ring_buffer) {
+    return WindowProcessSamplesRing(state, dc_notch_filter_state, samples,
+                                    num_samples, num_samples_read);
+  }
+
+  const int size = state->size;
+
+  // Copy samples from the samples buffer over to our local input.
+  size_t max_samples_to_copy = state->size - state->input_used;
+  if (max_samples_to_copy > num_samples) {
+    max_samples_to_copy = num_samples;
+  }
+  CopySamples(state, dc_notch_filter_state, samples,
+              state->input + state->input_used, max_samples_to_copy);
+  *num_samples_read = max_samples_to_copy;
+  state->input_used += max_samples_to_copy;
+
+  if (state->input_used < state->size) {
+    // We don't have enough samples to compute a window.
+    return 0;
+  }
+
+  // Apply the window to the input.
+  const int16_t max_abs_output_value =
+      ApplyWindow(state->input, state->coefficients, state->output, size, 0);
+
   // Shuffle the input down by the step size, and update how much we have used.
   memmove(state->input, state->input + state->step,
           sizeof(*state->input) * (state->size - state->step));
@@ -79,5 +294,6 @@ void WindowReset(struct WindowState* state) {
   memset(state->input, 0, state->size * sizeof(*state->input));
   memset(state->output, 0, state->size * sizeof(*state->output));
   state->input_used = 0;
+  state->input_start = 0;
   state->max_abs_output_value = 0;
 }
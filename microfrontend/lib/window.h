@@ -33,9 +33,16 @@ struct WindowState {
   size_t size;
   int16_t* coefficients;
   size_t step;
+  // Integer gain applied to the samples coming in, before the DC notch filter.
+  int input_gain;
 
   int16_t* input;
   size_t input_used;
+  // In ring buffer mode the input is a circular buffer, the oldest sample is
+  // at input_start. The window is applied directly from the ring, instead of
+  // shifting the input down by the step size after every window.
+  int ring_buffer;
+  size_t input_start;
   int16_t* output;
   int16_t max_abs_output_value;
 };
@@ -45,6 +52,13 @@ struct WindowState {
  int WindowProcessSamples(struct WindowState* state, struct DcNotchFilterState *dc_notch_filter_state, const int16_t* samples,
                          size_t num_samples, size_t* num_samples_read);
 
+// Same result as WindowProcessSamples in ring buffer mode. The gain, the DC
+// notch filter, the window and the max abs tracking of the samples completing
+// a window are done in a single pass, so that they are read only once.
+ int WindowProcessSamplesFused(struct WindowState* state, struct DcNotchFilterState *dc_notch_filter_state,
+                              const int16_t* samples, size_t num_samples,
+                              size_t* num_samples_read);
+
  void WindowReset(struct WindowState* state);
 
 #ifdef __cplusplus
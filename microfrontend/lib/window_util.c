@@ -29,12 +29,15 @@ This file has been modified by Silicon Labs.
 void WindowFillConfigWithDefaults(struct WindowConfig* config) {
   config->size_ms = 25;
   config->step_size_ms = 10;
+  config->ring_buffer = 0;
+  config->input_gain = 1;
 }
 
 int WindowPopulateState(const struct WindowConfig* config,
                         struct WindowState* state, int sample_rate) {
   state->size = config->size_ms * sample_rate / 1000;
   state->step = config->step_size_ms * sample_rate / 1000;
+  state->input_gain = config->input_gain;
 
   state->coefficients = malloc(state->size * sizeof(*state->coefficients));
   if (state->coefficients == NULL) {
@@ -53,6 +56,8 @@ int WindowPopulateState(const struct WindowConfig* config,
   }
 
   state->input_used = 0;
+  state->ring_buffer = config->ring_buffer;
+  state->input_start = 0;
   state->input = malloc(state->size * sizeof(*state->input));
   if (state->input == NULL) {
     fprintf(stderr, "Failed to allocate window input\n");
@@ -29,6 +29,11 @@ struct WindowConfig {
   size_t size_ms;
   // length of step for next frame in milliseconds
   size_t step_size_ms;
+  // keep the input in a circular buffer instead of moving it for every frame,
+  // off by default
+  int ring_buffer;
+  // integer gain applied to the samples coming in
+  int input_gain;
 };
 
 // Populates the WindowConfig with "sane" default values.
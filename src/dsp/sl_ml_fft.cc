@@ -29,49 +29,20 @@
  ******************************************************************************/
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 
 #include "inc/dsp/sl_ml_fft.h"
-//#include "microfrontend/config/sl_ml_frontend_config.h"
+#include "sl_ml_fft_config.h"
+#include "sl_ml_fft_tables.h"
 #include "arm_const_structs.h"
 #include "arm_common_tables.h"
 #include "dsp/transform_functions.h"
 
-// Helper Functions
-// #define SL_CONCAT(A, B) A ## B
-// #define CFFT_FUNCTION(N) SL_CONCAT(&arm_cfft_sR_q15_len, N)
-
-// Define length of complex FFT
-// #if SL_ML_FRONTEND_CONFIG_RFFT_LEN==8192
-//   #define SL_ML_CFFT_LEN 4096
-// #elif SL_ML_FRONTEND_CONFIG_RFFT_LEN==4096
-//   #define SL_ML_CFFT_LEN 2048
-// #elif SL_ML_FRONTEND_CONFIG_RFFT_LEN==2048
-//   #define SL_ML_CFFT_LEN 1024
-// #elif SL_ML_FRONTEND_CONFIG_RFFT_LEN==1024
-//   #define SL_ML_CFFT_LEN 512
-// #elif SL_ML_FRONTEND_CONFIG_RFFT_LEN==512
-//   #define SL_ML_CFFT_LEN 256
-// #elif SL_ML_FRONTEND_CONFIG_RFFT_LEN==256
-//   #define SL_ML_CFFT_LEN 128
-// #elif SL_ML_FRONTEND_CONFIG_RFFT_LEN==128
-//   #define SL_ML_CFFT_LEN 64
-// #elif SL_ML_FRONTEND_CONFIG_RFFT_LEN==64
-//   #define SL_ML_CFFT_LEN 32
-// #elif SL_ML_FRONTEND_CONFIG_RFFT_LEN==32
-//   #define SL_ML_CFFT_LEN 16
-// #endif
-
-
-// FFT Input and Output buffers
-// static int16_t *input_buffer[SL_ML_FRONTEND_CONFIG_RFFT_LEN];
-// static int16_t *output_buffer[SL_ML_FRONTEND_CONFIG_RFFT_LEN * 2];
-
-// RFFT instance
-static arm_rfft_instance_q15 rfft_instance;
-
-// Real Coefficient Tables
-static q15_t* __ALIGNED(4) real_coeff_table_A = nullptr;
-static q15_t* __ALIGNED(4) real_coeff_table_B = nullptr;
+#if SL_ML_FFT_MAX_LENGTH != 256 && SL_ML_FFT_MAX_LENGTH != 512   \
+  && SL_ML_FFT_MAX_LENGTH != 1024 && SL_ML_FFT_MAX_LENGTH != 2048 \
+  && SL_ML_FFT_MAX_LENGTH != 4096 && SL_ML_FFT_MAX_LENGTH != 8192
+#error "SL_ML_FFT_MAX_LENGTH must be a power of two from 256 to 8192"
+#endif
 
 /*******************************************************************************
  *  The real coefficient tables are used by the CMSIS rfft implementation during
@@ -80,18 +51,43 @@ static q15_t* __ALIGNED(4) real_coeff_table_B = nullptr;
  *
  *  The CMSIS DSP library provides the coefficient tables as large tables
  *  supporting different size FFT's up to 8192. In order to minimize ROM usage
- *  for shorter FFT lengths, this function re-generates the tables specific
- *  to the length of the FFT.
+ *  for shorter FFT lengths, the tables of SL_ML_FFT_MAX_LENGTH are generated
+ *  at build time by tool/dsp/generate_fft_tables.py. Like the CMSIS tables,
+ *  they serve every shorter FFT by stepping over coefficients.
  ******************************************************************************/
-static void generate_real_coeff_tables(int n){
-
-  // Generate the real coefficient tables
-  for (int i = 0; i < n; i++){
-     real_coeff_table_A[2 * i]     = (q15_t)roundf((0.5 * ( 1.0 - sinf(2 * PI / (float) (2 * n) * (float) i))) * powf(2,15));
-     real_coeff_table_A[2 * i + 1] = (q15_t)roundf((0.5 * (-1.0 * cosf(2 * PI / (float) (2 * n) * (float) i))) * powf(2,15));
-
-     real_coeff_table_B[2 * i]     = (q15_t)roundf((0.5 * (1.0 + sinf(2 * PI / (float) (2 * n) * (float) i))) * powf(2,15));
-     real_coeff_table_B[2 * i + 1] = (q15_t)roundf((0.5 * (1.0 * cosf(2 * PI / (float) (2 * n) * (float) i))) * powf(2,15));;
+#if SL_ML_FFT_MAX_LENGTH <= 2048
+#define REAL_COEFF_TABLE_A      sli_ml_fft_real_coeff_a
+#define REAL_COEFF_TABLE_B      sli_ml_fft_real_coeff_b
+#define REAL_COEFF_TABLE_LENGTH SL_ML_FFT_MAX_LENGTH
+#else
+#define REAL_COEFF_TABLE_A      realCoefAQ15
+#define REAL_COEFF_TABLE_B      realCoefBQ15
+#define REAL_COEFF_TABLE_LENGTH 8192
+#endif
+
+static const arm_cfft_instance_q15* get_cfft_instance(size_t cfft_len)
+{
+  switch (cfft_len) {
+    case 16:
+      return &arm_cfft_sR_q15_len16;
+    case 32:
+      return &arm_cfft_sR_q15_len32;
+    case 64:
+      return &arm_cfft_sR_q15_len64;
+    case 128:
+      return &arm_cfft_sR_q15_len128;
+    case 256:
+      return &arm_cfft_sR_q15_len256;
+    case 512:
+      return &arm_cfft_sR_q15_len512;
+    case 1024:
+      return &arm_cfft_sR_q15_len1024;
+    case 2048:
+      return &arm_cfft_sR_q15_len2048;
+    case 4096:
+      return &arm_cfft_sR_q15_len4096;
+    default:
+      return nullptr;
   }
 }
 
@@ -117,6 +113,17 @@ void sli_ml_fft_compute(struct sli_ml_fft_state* state, const int16_t* input,
     fft_input[i] = 0;
   }
 
+  // The RFFT instance only holds pointers to the tables, it is set up for
+  // every call so that each state can have its own size.
+  arm_rfft_instance_q15 rfft_instance;
+  rfft_instance.fftLenReal = static_cast<uint32_t>(fft_size);
+  rfft_instance.ifftFlagR = 0U;
+  rfft_instance.bitReverseFlagR = 1U;
+  rfft_instance.twidCoefRModifier = state->coeff_table_stride;
+  rfft_instance.pTwiddleAReal = state->coeff_table_a;
+  rfft_instance.pTwiddleBReal = state->coeff_table_b;
+  rfft_instance.pCfft = static_cast<const arm_cfft_instance_q15*>(state->cfft);
+
   // Apply the FFT.
   arm_rfft_q15(&rfft_instance, (q15_t*)fft_input, (q15_t*)state->output);
 }
@@ -126,12 +133,12 @@ void sli_ml_fft_compute(struct sli_ml_fft_state* state, const int16_t* input,
  *****************************************************************************/
 sl_status_t sli_ml_fft_init(struct sli_ml_fft_state* state, size_t input_size) {
 
-  if (input_size < 16 || input_size > 8192){
+  if (input_size < 16 || input_size > SL_ML_FFT_MAX_LENGTH){
     return SL_STATUS_INVALID_CONFIGURATION;
   }
 
   size_t rfft_size = 32;
-  for(; rfft_size <= 8192; rfft_size <<=1)
+  for(; rfft_size <= SL_ML_FFT_MAX_LENGTH; rfft_size <<=1)
   {
     if(input_size <= rfft_size)
     {
@@ -142,6 +149,12 @@ sl_status_t sli_ml_fft_init(struct sli_ml_fft_state* state, size_t input_size) {
   // Initialize FFT struct
   state->input_size = input_size;
   state->fft_size = rfft_size;
+  state->input = nullptr;
+  state->output = nullptr;
+  state->coeff_table_ram = nullptr;
+
+  state->cfft = get_cfft_instance(rfft_size / 2);
+  assert(state->cfft != nullptr);
 
   state->input = static_cast<int16_t*>(malloc(rfft_size * sizeof(int16_t)));
   if(state->input == nullptr)
@@ -154,62 +167,31 @@ sl_status_t sli_ml_fft_init(struct sli_ml_fft_state* state, size_t input_size) {
     return SL_STATUS_ALLOCATION_FAILED;
   }
 
-  real_coeff_table_A  = static_cast<int16_t*>(malloc(rfft_size * sizeof(int16_t)));
-  if(real_coeff_table_A == nullptr)
-  {
-    return SL_STATUS_ALLOCATION_FAILED;
-  }
-  real_coeff_table_B  = static_cast<int16_t*>(malloc(rfft_size * sizeof(int16_t)));
-  if(real_coeff_table_B == nullptr)
+  // Use every stride'th coefficient of the tables in flash.
+  const uint16_t stride = static_cast<uint16_t>(REAL_COEFF_TABLE_LENGTH / rfft_size);
+  state->coeff_table_a = REAL_COEFF_TABLE_A;
+  state->coeff_table_b = REAL_COEFF_TABLE_B;
+  state->coeff_table_stride = stride;
+
+#if SL_ML_FFT_TABLES_IN_RAM
+  // Copy the coefficients used by this FFT size next to each other.
+  state->coeff_table_ram = static_cast<int16_t*>(malloc(2 * rfft_size * sizeof(int16_t)));
+  if(state->coeff_table_ram == nullptr)
   {
     return SL_STATUS_ALLOCATION_FAILED;
   }
-
-  // Generate tables
-  generate_real_coeff_tables(rfft_size/2);
-
-  // Set up RFFT instance
-  rfft_instance.fftLenReal = (uint16_t) rfft_size;
-  rfft_instance.pTwiddleAReal = (q15_t *) real_coeff_table_A;
-  rfft_instance.pTwiddleBReal = (q15_t *) real_coeff_table_B;
-  rfft_instance.ifftFlagR = 0U;
-  rfft_instance.bitReverseFlagR = 1U;
-
-  // Set modifier to 1 when using the autogenerate coeftables
-  rfft_instance.twidCoefRModifier = 1U;
-  const int cfft_len = rfft_size / 2;
-  switch(cfft_len)
-  {
-  case 16:
-    rfft_instance.pCfft = &arm_cfft_sR_q15_len16;
-    break;
-  case 32:
-    rfft_instance.pCfft = &arm_cfft_sR_q15_len32;
-    break;
-  case 64:
-    rfft_instance.pCfft = &arm_cfft_sR_q15_len64;
-    break;
-  case 128:
-    rfft_instance.pCfft = &arm_cfft_sR_q15_len128;
-    break;
-  case 256:
-    rfft_instance.pCfft = &arm_cfft_sR_q15_len256;
-    break;
-  case 512:
-    rfft_instance.pCfft = &arm_cfft_sR_q15_len512;
-    break;
-  case 1024:
-    rfft_instance.pCfft = &arm_cfft_sR_q15_len1024;
-    break;
-  case 2048:
-    rfft_instance.pCfft = &arm_cfft_sR_q15_len2048;
-    break;
-  case 4096:
-    rfft_instance.pCfft = &arm_cfft_sR_q15_len4096;
-    break;
-  default:
-    assert(!"Bad cfft length");
+  int16_t* table_a = state->coeff_table_ram;
+  int16_t* table_b = state->coeff_table_ram + rfft_size;
+  for (size_t i = 0; i < rfft_size / 2; i++) {
+    table_a[2 * i]     = REAL_COEFF_TABLE_A[2 * i * stride];
+    table_a[2 * i + 1] = REAL_COEFF_TABLE_A[2 * i * stride + 1];
+    table_b[2 * i]     = REAL_COEFF_TABLE_B[2 * i * stride];
+    table_b[2 * i + 1] = REAL_COEFF_TABLE_B[2 * i * stride + 1];
   }
+  state->coeff_table_a = table_a;
+  state->coeff_table_b = table_b;
+  state->coeff_table_stride = 1U;
+#endif
 
   return SL_STATUS_OK;
 }
@@ -226,15 +208,10 @@ void sli_ml_fft_deinit(struct sli_ml_fft_state* state)
     free(state->output);
     state->output = nullptr;
   }
-  if(real_coeff_table_A != nullptr)
+  if(state->coeff_table_ram != nullptr)
   {
-    free(real_coeff_table_A);
-    real_coeff_table_A = nullptr;
-  }
-  if(real_coeff_table_B != nullptr)
-  {
-    free(real_coeff_table_B);
-    real_coeff_table_B = nullptr;
+    free(state->coeff_table_ram);
+    state->coeff_table_ram = nullptr;
   }
 }
 
@@ -245,6 +222,3 @@ void sli_ml_fft_reset(struct sli_ml_fft_state* state){
   memset(state->input, 0, state->fft_size * sizeof(*state->input));
   memset(state->output, 0, (state->fft_size / 2 + 1) * sizeof(*state->output));
 }
-
-
-
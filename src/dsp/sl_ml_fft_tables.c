@@ -0,0 +1,711 @@
+/***************************************************************************//**
+ * @file
+ * @brief SL_ML_FFT real coefficient tables
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Generated by tool/dsp/generate_fft_tables.py, do not edit.
+
+#include "sl_ml_fft_tables.h"
+
+#if SL_ML_FFT_MAX_LENGTH == 256
+
+const int16_t sli_ml_fft_real_coeff_a[256] = {
+  16384, -16384, 15982, -16379, 15580, -16364, 15179, -16340, 14778, -16305, 14378, -16261,
+  13980, -16207, 13583, -16143, 13188, -16069, 12794, -15986, 12403, -15893, 12014, -15791,
+  11628, -15679, 11245, -15557, 10864, -15426, 10487, -15286, 10114, -15137, 9745, -14978,
+  9379, -14811, 9018, -14635, 8661, -14449, 8308, -14256, 7961, -14053, 7619, -13842,
+  7282, -13623, 6950, -13395, 6624, -13160, 6304, -12916, 5990, -12665, 5682, -12406,
+  5381, -12140, 5087, -11866, 4799, -11585, 4518, -11297, 4244, -11003, 3978, -10702,
+  3719, -10394, 3468, -10080, 3224, -9760, 2989, -9434, 2761, -9102, 2542, -8765,
+  2331, -8423, 2128, -8076, 1935, -7723, 1749, -7366, 1573, -7005, 1406, -6639,
+  1247, -6270, 1098, -5897, 958, -5520, 827, -5139, 705, -4756, 593, -4370,
+  491, -3981, 398, -3590, 315, -3196, 241, -2801, 177, -2404, 123, -2006,
+  79, -1606, 44, -1205, 20, -804, 5, -402, 0, 0, 5, 402,
+  20, 804, 44, 1205, 79, 1606, 123, 2006, 177, 2404, 241, 2801,
+  315, 3196, 398, 3590, 491, 3981, 593, 4370, 705, 4756, 827, 5139,
+  958, 5520, 1098, 5897, 1247, 6270, 1406, 6639, 1573, 7005, 1749, 7366,
+  1935, 7723, 2128, 8076, 2331, 8423, 2542, 8765, 2761, 9102, 2989, 9434,
+  3224, 9760, 3468, 10080, 3719, 10394, 3978, 10702, 4244, 11003, 4518, 11297,
+  4799, 11585, 5087, 11866, 5381, 12140, 5682, 12406, 5990, 12665, 6304, 12916,
+  6624, 13160, 6950, 13395, 7282, 13623, 7619, 13842, 7961, 14053, 8308, 14256,
+  8661, 14449, 9018, 14635, 9379, 14811, 9745, 14978, 10114, 15137, 10487, 15286,
+  10864, 15426, 11245, 15557, 11628, 15679, 12014, 15791, 12403, 15893, 12794, 15986,
+  13188, 16069, 13583, 16143, 13980, 16207, 14378, 16261, 14778, 16305, 15179, 16340,
+  15580, 16364, 15982, 16379,
+};
+
+const int16_t sli_ml_fft_real_coeff_b[256] = {
+  16384, 16384, 16786, 16379, 17188, 16364, 17589, 16340, 17990, 16305, 18390, 16261,
+  18788, 16207, 19185, 16143, 19580, 16069, 19974, 15986, 20365, 15893, 20754, 15791,
+  21140, 15679, 21523, 15557, 21904, 15426, 22281, 15286, 22654, 15137, 23023, 14978,
+  23389, 14811, 23750, 14635, 24107, 14449, 24460, 14256, 24807, 14053, 25149, 13842,
+  25486, 13623, 25818, 13395, 26144, 13160, 26464, 12916, 26778, 12665, 27086, 12406,
+  27387, 12140, 27681, 11866, 27969, 11585, 28250, 11297, 28524, 11003, 28790, 10702,
+  29049, 10394, 29300, 10080, 29544, 9760, 29779, 9434, 30007, 9102, 30226, 8765,
+  30437, 8423, 30640, 8076, 30833, 7723, 31019, 7366, 31195, 7005, 31362, 6639,
+  31521, 6270, 31670, 5897, 31810, 5520, 31941, 5139, 32063, 4756, 32175, 4370,
+  32277, 3981, 32370, 3590, 32453, 3196, 32527, 2801, 32591, 2404, 32645, 2006,
+  32689, 1606, 32724, 1205, 32748, 804, 32763, 402, 32767, 0, 32763, -402,
+  32748, -804, 32724, -1205, 32689, -1606, 32645, -2006, 32591, -2404, 32527, -2801,
+  32453, -3196, 32370, -3590, 32277, -3981, 32175, -4370, 32063, -4756, 31941, -5139,
+  31810, -5520, 31670, -5897, 31521, -6270, 31362, -6639, 31195, -7005, 31019, -7366,
+  30833, -7723, 30640, -8076, 30437, -8423, 30226, -8765, 30007, -9102, 29779, -9434,
+  29544, -9760, 29300, -10080, 29049, -10394, 28790, -10702, 28524, -11003, 28250, -11297,
+  27969, -11585, 27681, -11866, 27387, -12140, 27086, -12406, 26778, -12665, 26464, -12916,
+  26144, -13160, 25818, -13395, 25486, -13623, 25149, -13842, 24807, -14053, 24460, -14256,
+  24107, -14449, 23750, -14635, 23389, -14811, 23023, -14978, 22654, -15137, 22281, -15286,
+  21904, -15426, 21523, -15557, 21140, -15679, 20754, -15791, 20365, -15893, 19974, -15986,
+  19580, -16069, 19185, -16143, 18788, -16207, 18390, -16261, 17990, -16305, 17589, -16340,
+  17188, -16364, 16786, -16379,
+};
+
+#elif SL_ML_FFT_MAX_LENGTH == 512
+
+const int16_t sli_ml_fft_real_coeff_a[512] = {
+  16384, -16384, 16183, -16383, 15982, -16379, 15781, -16373, 15580, -16364, 15379, -16353,
+  15179, -16340, 14978, -16324, 14778, -16305, 14578, -16284, 14378, -16261, 14179, -16235,
+  13980, -16207, 13781, -16176, 13583, -16143, 13385, -16107, 13188, -16069, 12991, -16029,
+  12794, -15986, 12598, -15941, 12403, -15893, 12208, -15843, 12014, -15791, 11821, -15736,
+  11628, -15679, 11436, -15619, 11245, -15557, 11054, -15493, 10864, -15426, 10676, -15357,
+  10487, -15286, 10300, -15213, 10114, -15137, 9929, -15059, 9745, -14978, 9561, -14896,
+  9379, -14811, 9198, -14724, 9018, -14635, 8839, -14543, 8661, -14449, 8484, -14354,
+  8308, -14256, 8134, -14155, 7961, -14053, 7789, -13949, 7619, -13842, 7449, -13733,
+  7282, -13623, 7115, -13510, 6950, -13395, 6786, -13279, 6624, -13160, 6463, -13039,
+  6304, -12916, 6146, -12792, 5990, -12665, 5835, -12537, 5682, -12406, 5531, -12274,
+  5381, -12140, 5233, -12004, 5087, -11866, 4942, -11727, 4799, -11585, 4657, -11442,
+  4518, -11297, 4380, -11151, 4244, -11003, 4110, -10853, 3978, -10702, 3847, -10549,
+  3719, -10394, 3592, -10238, 3468, -10080, 3345, -9921, 3224, -9760, 3105, -9598,
+  2989, -9434, 2874, -9269, 2761, -9102, 2651, -8935, 2542, -8765, 2435, -8595,
+  2331, -8423, 2229, -8250, 2128, -8076, 2030, -7900, 1935, -7723, 1841, -7545,
+  1749, -7366, 1660, -7186, 1573, -7005, 1488, -6823, 1406, -6639, 1325, -6455,
+  1247, -6270, 1171, -6084, 1098, -5897, 1027, -5708, 958, -5520, 891, -5330,
+  827, -5139, 765, -4948, 705, -4756, 648, -4563, 593, -4370, 541, -4176,
+  491, -3981, 443, -3786, 398, -3590, 355, -3393, 315, -3196, 277, -2999,
+  241, -2801, 208, -2603, 177, -2404, 149, -2205, 123, -2006, 100, -1806,
+  79, -1606, 60, -1406, 44, -1205, 31, -1005, 20, -804, 11, -603,
+  5, -402, 1, -201, 0, 0, 1, 201, 5, 402, 11, 603,
+  20, 804, 31, 1005, 44, 1205, 60, 1406, 79, 1606, 100, 1806,
+  123, 2006, 149, 2205, 177, 2404, 208, 2603, 241, 2801, 277, 2999,
+  315, 3196, 355, 3393, 398, 3590, 443, 3786, 491, 3981, 541, 4176,
+  593, 4370, 648, 4563, 705, 4756, 765, 4948, 827, 5139, 891, 5330,
+  958, 5520, 1027, 5708, 1098, 5897, 1171, 6084, 1247, 6270, 1325, 6455,
+  1406, 6639, 1488, 6823, 1573, 7005, 1660, 7186, 1749, 7366, 1841, 7545,
+  1935, 7723, 2030, 7900, 2128, 8076, 2229, 8250, 2331, 8423, 2435, 8595,
+  2542, 8765, 2651, 8935, 2761, 9102, 2874, 9269, 2989, 9434, 3105, 9598,
+  3224, 9760, 3345, 9921, 3468, 10080, 3592, 10238, 3719, 10394, 3847, 10549,
+  3978, 10702, 4110, 10853, 4244, 11003, 4380, 11151, 4518, 11297, 4657, 11442,
+  4799, 11585, 4942, 11727, 5087, 11866, 5233, 12004, 5381, 12140, 5531, 12274,
+  5682, 12406, 5835, 12537, 5990, 12665, 6146, 12792, 6304, 12916, 6463, 13039,
+  6624, 13160, 6786, 13279, 6950, 13395, 7115, 13510, 7282, 13623, 7449, 13733,
+  7619, 13842, 7789, 13949, 7961, 14053, 8134, 14155, 8308, 14256, 8484, 14354,
+  8661, 14449, 8839, 14543, 9018, 14635, 9198, 14724, 9379, 14811, 9561, 14896,
+  9745, 14978, 9929, 15059, 10114, 15137, 10300, 15213, 10487, 15286, 10676, 15357,
+  10864, 15426, 11054, 15493, 11245, 15557, 11436, 15619, 11628, 15679, 11821, 15736,
+  12014, 15791, 12208, 15843, 12403, 15893, 12598, 15941, 12794, 15986, 12991, 16029,
+  13188, 16069, 13385, 16107, 13583, 16143, 13781, 16176, 13980, 16207, 14179, 16235,
+  14378, 16261, 14578, 16284, 14778, 16305, 14978, 16324, 15179, 16340, 15379, 16353,
+  15580, 16364, 15781, 16373, 15982, 16379, 16183, 16383,
+};
+
+const int16_t sli_ml_fft_real_coeff_b[512] = {
+  16384, 16384, 16585, 16383, 16786, 16379, 16987, 16373, 17188, 16364, 17389, 16353,
+  17589, 16340, 17790, 16324, 17990, 16305, 18190, 16284, 18390, 16261, 18589, 16235,
+  18788, 16207, 18987, 16176, 19185, 16143, 19383, 16107, 19580, 16069, 19777, 16029,
+  19974, 15986, 20170, 15941, 20365, 15893, 20560, 15843, 20754, 15791, 20947, 15736,
+  21140, 15679, 21332, 15619, 21523, 15557, 21714, 15493, 21904, 15426, 22092, 15357,
+  22281, 15286, 22468, 15213, 22654, 15137, 22839, 15059, 23023, 14978, 23207, 14896,
+  23389, 14811, 23570, 14724, 23750, 14635, 23929, 14543, 24107, 14449, 24284, 14354,
+  24460, 14256, 24634, 14155, 24807, 14053, 24979, 13949, 25149, 13842, 25319, 13733,
+  25486, 13623, 25653, 13510, 25818, 13395, 25982, 13279, 26144, 13160, 26305, 13039,
+  26464, 12916, 26622, 12792, 26778, 12665, 26933, 12537, 27086, 12406, 27237, 12274,
+  27387, 12140, 27535, 12004, 27681, 11866, 27826, 11727, 27969, 11585, 28111, 11442,
+  28250, 11297, 28388, 11151, 28524, 11003, 28658, 10853, 28790, 10702, 28921, 10549,
+  29049, 10394, 29176, 10238, 29300, 10080, 29423, 9921, 29544, 9760, 29663, 9598,
+  29779, 9434, 29894, 9269, 30007, 9102, 30117, 8935, 30226, 8765, 30333, 8595,
+  30437, 8423, 30539, 8250, 30640, 8076, 30738, 7900, 30833, 7723, 30927, 7545,
+  31019, 7366, 31108, 7186, 31195, 7005, 31280, 6823, 31362, 6639, 31443, 6455,
+  31521, 6270, 31597, 6084, 31670, 5897, 31741, 5708, 31810, 5520, 31877, 5330,
+  31941, 5139, 32003, 4948, 32063, 4756, 32120, 4563, 32175, 4370, 32227, 4176,
+  32277, 3981, 32325, 3786, 32370, 3590, 32413, 3393, 32453, 3196, 32491, 2999,
+  32527, 2801, 32560, 2603, 32591, 2404, 32619, 2205, 32645, 2006, 32668, 1806,
+  32689, 1606, 32708, 1406, 32724, 1205, 32737, 1005, 32748, 804, 32757, 603,
+  32763, 402, 32767, 201, 32767, 0, 32767, -201, 32763, -402, 32757, -603,
+  32748, -804, 32737, -1005, 32724, -1205, 32708, -1406, 32689, -1606, 32668, -1806,
+  32645, -2006, 32619, -2205, 32591, -2404, 32560, -2603, 32527, -2801, 32491, -2999,
+  32453, -3196, 32413, -3393, 32370, -3590, 32325, -3786, 32277, -3981, 32227, -4176,
+  32175, -4370, 32120, -4563, 32063, -4756, 32003, -4948, 31941, -5139, 31877, -5330,
+  31810, -5520, 31741, -5708, 31670, -5897, 31597, -6084, 31521, -6270, 31443, -6455,
+  31362, -6639, 31280, -6823, 31195, -7005, 31108, -7186, 31019, -7366, 30927, -7545,
+  30833, -7723, 30738, -7900, 30640, -8076, 30539, -8250, 30437, -8423, 30333, -8595,
+  30226, -8765, 30117, -8935, 30007, -9102, 29894, -9269, 29779, -9434, 29663, -9598,
+  29544, -9760, 29423, -9921, 29300, -10080, 29176, -10238, 29049, -10394, 28921, -10549,
+  28790, -10702, 28658, -10853, 28524, -11003, 28388, -11151, 28250, -11297, 28111, -11442,
+  27969, -11585, 27826, -11727, 27681, -11866, 27535, -12004, 27387, -12140, 27237, -12274,
+  27086, -12406, 26933, -12537, 26778, -12665, 26622, -12792, 26464, -12916, 26305, -13039,
+  26144, -13160, 25982, -13279, 25818, -13395, 25653, -13510, 25486, -13623, 25319, -13733,
+  25149, -13842, 24979, -13949, 24807, -14053, 24634, -14155, 24460, -14256, 24284, -14354,
+  24107, -14449, 23929, -14543, 23750, -14635, 23570, -14724, 23389, -14811, 23207, -14896,
+  23023, -14978, 22839, -15059, 22654, -15137, 22468, -15213, 22281, -15286, 22092, -15357,
+  21904, -15426, 21714, -15493, 21523, -15557, 21332, -15619, 21140, -15679, 20947, -15736,
+  20754, -15791, 20560, -15843, 20365, -15893, 20170, -15941, 19974, -15986, 19777, -16029,
+  19580, -16069, 19383, -16107, 19185, -16143, 18987, -16176, 18788, -16207, 18589, -16235,
+  18390, -16261, 18190, -16284, 17990, -16305, 17790, -16324, 17589, -16340, 17389, -16353,
+  17188, -16364, 16987, -16373, 16786, -16379, 16585, -16383,
+};
+
+#elif SL_ML_FFT_MAX_LENGTH == 1024
+
+const int16_t sli_ml_fft_real_coeff_a[1024] = {
+  16384, -16384, 16283, -16384, 16183, -16383, 16082, -16381, 15982, -16379, 15881, -16376,
+  15781, -16373, 15680, -16369, 15580, -16364, 15480, -16359, 15379, -16353, 15279, -16347,
+  15179, -16340, 15078, -16332, 14978, -16324, 14878, -16315, 14778, -16305, 14678, -16295,
+  14578, -16284, 14478, -16273, 14378, -16261, 14279, -16248, 14179, -16235, 14079, -16221,
+  13980, -16207, 13881, -16192, 13781, -16176, 13682, -16160, 13583, -16143, 13484, -16125,
+  13385, -16107, 13286, -16088, 13188, -16069, 13089, -16049, 12991, -16029, 12892, -16008,
+  12794, -15986, 12696, -15964, 12598, -15941, 12501, -15917, 12403, -15893, 12306, -15868,
+  12208, -15843, 12111, -15817, 12014, -15791, 11917, -15763, 11821, -15736, 11724, -15707,
+  11628, -15679, 11532, -15649, 11436, -15619, 11340, -15588, 11245, -15557, 11149, -15525,
+  11054, -15493, 10959, -15460, 10864, -15426, 10770, -15392, 10676, -15357, 10581, -15322,
+  10487, -15286, 10394, -15250, 10300, -15213, 10207, -15175, 10114, -15137, 10021, -15098,
+  9929, -15059, 9837, -15019, 9745, -14978, 9653, -14937, 9561, -14896, 9470, -14854,
+  9379, -14811, 9288, -14768, 9198, -14724, 9108, -14680, 9018, -14635, 8928, -14589,
+  8839, -14543, 8749, -14497, 8661, -14449, 8572, -14402, 8484, -14354, 8396, -14305,
+  8308, -14256, 8221, -14206, 8134, -14155, 8047, -14104, 7961, -14053, 7875, -14001,
+  7789, -13949, 7704, -13896, 7619, -13842, 7534, -13788, 7449, -13733, 7365, -13678,
+  7282, -13623, 7198, -13567, 7115, -13510, 7032, -13453, 6950, -13395, 6868, -13337,
+  6786, -13279, 6705, -13219, 6624, -13160, 6543, -13100, 6463, -13039, 6383, -12978,
+  6304, -12916, 6225, -12854, 6146, -12792, 6068, -12729, 5990, -12665, 5913, -12601,
+  5835, -12537, 5759, -12472, 5682, -12406, 5606, -12340, 5531, -12274, 5456, -12207,
+  5381, -12140, 5307, -12072, 5233, -12004, 5160, -11935, 5087, -11866, 5014, -11797,
+  4942, -11727, 4870, -11656, 4799, -11585, 4728, -11514, 4657, -11442, 4587, -11370,
+  4518, -11297, 4449, -11224, 4380, -11151, 4312, -11077, 4244, -11003, 4177, -10928,
+  4110, -10853, 4044, -10778, 3978, -10702, 3912, -10625, 3847, -10549, 3783, -10471,
+  3719, -10394, 3655, -10316, 3592, -10238, 3530, -10159, 3468, -10080, 3406, -10001,
+  3345, -9921, 3284, -9841, 3224, -9760, 3165, -9679, 3105, -9598, 3047, -9516,
+  2989, -9434, 2931, -9352, 2874, -9269, 2817, -9186, 2761, -9102, 2706, -9019,
+  2651, -8935, 2596, -8850, 2542, -8765, 2488, -8680, 2435, -8595, 2383, -8509,
+  2331, -8423, 2280, -8337, 2229, -8250, 2178, -8163, 2128, -8076, 2079, -7988,
+  2030, -7900, 1982, -7812, 1935, -7723, 1887, -7635, 1841, -7545, 1795, -7456,
+  1749, -7366, 1704, -7276, 1660, -7186, 1616, -7096, 1573, -7005, 1530, -6914,
+  1488, -6823, 1447, -6731, 1406, -6639, 1365, -6547, 1325, -6455, 1286, -6363,
+  1247, -6270, 1209, -6177, 1171, -6084, 1134, -5990, 1098, -5897, 1062, -5803,
+  1027, -5708, 992, -5614, 958, -5520, 924, -5425, 891, -5330, 859, -5235,
+  827, -5139, 796, -5044, 765, -4948, 735, -4852, 705, -4756, 677, -4660,
+  648, -4563, 621, -4467, 593, -4370, 567, -4273, 541, -4176, 516, -4078,
+  491, -3981, 467, -3883, 443, -3786, 420, -3688, 398, -3590, 376, -3492,
+  355, -3393, 335, -3295, 315, -3196, 296, -3098, 277, -2999, 259, -2900,
+  241, -2801, 224, -2702, 208, -2603, 192, -2503, 177, -2404, 163, -2305,
+  149, -2205, 136, -2105, 123, -2006, 111, -1906, 100, -1806, 89, -1706,
+  79, -1606, 69, -1506, 60, -1406, 52, -1306, 44, -1205, 37, -1105,
+  31, -1005, 25, -904, 20, -804, 15, -704, 11, -603, 8, -503,
+  5, -402, 3, -302, 1, -201, 0, -101, 0, 0, 0, 101,
+  1, 201, 3, 302, 5, 402, 8, 503, 11, 603, 15, 704,
+  20, 804, 25, 904, 31, 1005, 37, 1105, 44, 1205, 52, 1306,
+  60, 1406, 69, 1506, 79, 1606, 89, 1706, 100, 1806, 111, 1906,
+  123, 2006, 136, 2105, 149, 2205, 163, 2305, 177, 2404, 192, 2503,
+  208, 2603, 224, 2702, 241, 2801, 259, 2900, 277, 2999, 296, 3098,
+  315, 3196, 335, 3295, 355, 3393, 376, 3492, 398, 3590, 420, 3688,
+  443, 3786, 467, 3883, 491, 3981, 516, 4078, 541, 4176, 567, 4273,
+  593, 4370, 621, 4467, 648, 4563, 677, 4660, 705, 4756, 735, 4852,
+  765, 4948, 796, 5044, 827, 5139, 859, 5235, 891, 5330, 924, 5425,
+  958, 5520, 992, 5614, 1027, 5708, 1062, 5803, 1098, 5897, 1134, 5990,
+  1171, 6084, 1209, 6177, 1247, 6270, 1286, 6363, 1325, 6455, 1365, 6547,
+  1406, 6639, 1447, 6731, 1488, 6823, 1530, 6914, 1573, 7005, 1616, 7096,
+  1660, 7186, 1704, 7276, 1749, 7366, 1795, 7456, 1841, 7545, 1887, 7635,
+  1935, 7723, 1982, 7812, 2030, 7900, 2079, 7988, 2128, 8076, 2178, 8163,
+  2229, 8250, 2280, 8337, 2331, 8423, 2383, 8509, 2435, 8595, 2488, 8680,
+  2542, 8765, 2596, 8850, 2651, 8935, 2706, 9019, 2761, 9102, 2817, 9186,
+  2874, 9269, 2931, 9352, 2989, 9434, 3047, 9516, 3105, 9598, 3165, 9679,
+  3224, 9760, 3284, 9841, 3345, 9921, 3406, 10001, 3468, 10080, 3530, 10159,
+  3592, 10238, 3655, 10316, 3719, 10394, 3783, 10471, 3847, 10549, 3912, 10625,
+  3978, 10702, 4044, 10778, 4110, 10853, 4177, 10928, 4244, 11003, 4312, 11077,
+  4380, 11151, 4449, 11224, 4518, 11297, 4587, 11370, 4657, 11442, 4728, 11514,
+  4799, 11585, 4870, 11656, 4942, 11727, 5014, 11797, 5087, 11866, 5160, 11935,
+  5233, 12004, 5307, 12072, 5381, 12140, 5456, 12207, 5531, 12274, 5606, 12340,
+  5682, 12406, 5759, 12472, 5835, 12537, 5913, 12601, 5990, 12665, 6068, 12729,
+  6146, 12792, 6225, 12854, 6304, 12916, 6383, 12978, 6463, 13039, 6543, 13100,
+  6624, 13160, 6705, 13219, 6786, 13279, 6868, 13337, 6950, 13395, 7032, 13453,
+  7115, 13510, 7198, 13567, 7282, 13623, 7365, 13678, 7449, 13733, 7534, 13788,
+  7619, 13842, 7704, 13896, 7789, 13949, 7875, 14001, 7961, 14053, 8047, 14104,
+  8134, 14155, 8221, 14206, 8308, 14256, 8396, 14305, 8484, 14354, 8572, 14402,
+  8661, 14449, 8749, 14497, 8839, 14543, 8928, 14589, 9018, 14635, 9108, 14680,
+  9198, 14724, 9288, 14768, 9379, 14811, 9470, 14854, 9561, 14896, 9653, 14937,
+  9745, 14978, 9837, 15019, 9929, 15059, 10021, 15098, 10114, 15137, 10207, 15175,
+  10300, 15213, 10394, 15250, 10487, 15286, 10581, 15322, 10676, 15357, 10770, 15392,
+  10864, 15426, 10959, 15460, 11054, 15493, 11149, 15525, 11245, 15557, 11340, 15588,
+  11436, 15619, 11532, 15649, 11628, 15679, 11724, 15707, 11821, 15736, 11917, 15763,
+  12014, 15791, 12111, 15817, 12208, 15843, 12306, 15868, 12403, 15893, 12501, 15917,
+  12598, 15941, 12696, 15964, 12794, 15986, 12892, 16008, 12991, 16029, 13089, 16049,
+  13188, 16069, 13286, 16088, 13385, 16107, 13484, 16125, 13583, 16143, 13682, 16160,
+  13781, 16176, 13881, 16192, 13980, 16207, 14079, 16221, 14179, 16235, 14279, 16248,
+  14378, 16261, 14478, 16273, 14578, 16284, 14678, 16295, 14778, 16305, 14878, 16315,
+  14978, 16324, 15078, 16332, 15179, 16340, 15279, 16347, 15379, 16353, 15480, 16359,
+  15580, 16364, 15680, 16369, 15781, 16373, 15881, 16376, 15982, 16379, 16082, 16381,
+  16183, 16383, 16283, 16384,
+};
+
+const int16_t sli_ml_fft_real_coeff_b[1024] = {
+  16384, 16384, 16485, 16384, 16585, 16383, 16686, 16381, 16786, 16379, 16887, 16376,
+  16987, 16373, 17088, 16369, 17188, 16364, 17288, 16359, 17389, 16353, 17489, 16347,
+  17589, 16340, 17690, 16332, 17790, 16324, 17890, 16315, 17990, 16305, 18090, 16295,
+  18190, 16284, 18290, 16273, 18390, 16261, 18489, 16248, 18589, 16235, 18689, 16221,
+  18788, 16207, 18887, 16192, 18987, 16176, 19086, 16160, 19185, 16143, 19284, 16125,
+  19383, 16107, 19482, 16088, 19580, 16069, 19679, 16049, 19777, 16029, 19876, 16008,
+  19974, 15986, 20072, 15964, 20170, 15941, 20267, 15917, 20365, 15893, 20462, 15868,
+  20560, 15843, 20657, 15817, 20754, 15791, 20851, 15763, 20947, 15736, 21044, 15707,
+  21140, 15679, 21236, 15649, 21332, 15619, 21428, 15588, 21523, 15557, 21619, 15525,
+  21714, 15493, 21809, 15460, 21904, 15426, 21998, 15392, 22092, 15357, 22187, 15322,
+  22281, 15286, 22374, 15250, 22468, 15213, 22561, 15175, 22654, 15137, 22747, 15098,
+  22839, 15059, 22931, 15019, 23023, 14978, 23115, 14937, 23207, 14896, 23298, 14854,
+  23389, 14811, 23480, 14768, 23570, 14724, 23660, 14680, 23750, 14635, 23840, 14589,
+  23929, 14543, 24019, 14497, 24107, 14449, 24196, 14402, 24284, 14354, 24372, 14305,
+  24460, 14256, 24547, 14206, 24634, 14155, 24721, 14104, 24807, 14053, 24893, 14001,
+  24979, 13949, 25064, 13896, 25149, 13842, 25234, 13788, 25319, 13733, 25403, 13678,
+  25486, 13623, 25570, 13567, 25653, 13510, 25736, 13453, 25818, 13395, 25900, 13337,
+  25982, 13279, 26063, 13219, 26144, 13160, 26225, 13100, 26305, 13039, 26385, 12978,
+  26464, 12916, 26543, 12854, 26622, 12792, 26700, 12729, 26778, 12665, 26855, 12601,
+  26933, 12537, 27009, 12472, 27086, 12406, 27162, 12340, 27237, 12274, 27312, 12207,
+  27387, 12140, 27461, 12072, 27535, 12004, 27608, 11935, 27681, 11866, 27754, 11797,
+  27826, 11727, 27898, 11656, 27969, 11585, 28040, 11514, 28111, 11442, 28181, 11370,
+  28250, 11297, 28319, 11224, 28388, 11151, 28456, 11077, 28524, 11003, 28591, 10928,
+  28658, 10853, 28724, 10778, 28790, 10702, 28856, 10625, 28921, 10549, 28985, 10471,
+  29049, 10394, 29113, 10316, 29176, 10238, 29238, 10159, 29300, 10080, 29362, 10001,
+  29423, 9921, 29484, 9841, 29544, 9760, 29603, 9679, 29663, 9598, 29721, 9516,
+  29779, 9434, 29837, 9352, 29894, 9269, 29951, 9186, 30007, 9102, 30062, 9019,
+  30117, 8935, 30172, 8850, 30226, 8765, 30280, 8680, 30333, 8595, 30385, 8509,
+  30437, 8423, 30488, 8337, 30539, 8250, 30590, 8163, 30640, 8076, 30689, 7988,
+  30738, 7900, 30786, 7812, 30833, 7723, 30881, 7635, 30927, 7545, 30973, 7456,
+  31019, 7366, 31064, 7276, 31108, 7186, 31152, 7096, 31195, 7005, 31238, 6914,
+  31280, 6823, 31321, 6731, 31362, 6639, 31403, 6547, 31443, 6455, 31482, 6363,
+  31521, 6270, 31559, 6177, 31597, 6084, 31634, 5990, 31670, 5897, 31706, 5803,
+  31741, 5708, 31776, 5614, 31810, 5520, 31844, 5425, 31877, 5330, 31909, 5235,
+  31941, 5139, 31972, 5044, 32003, 4948, 32033, 4852, 32063, 4756, 32091, 4660,
+  32120, 4563, 32147, 4467, 32175, 4370, 32201, 4273, 32227, 4176, 32252, 4078,
+  32277, 3981, 32301, 3883, 32325, 3786, 32348, 3688, 32370, 3590, 32392, 3492,
+  32413, 3393, 32433, 3295, 32453, 3196, 32472, 3098, 32491, 2999, 32509, 2900,
+  32527, 2801, 32544, 2702, 32560, 2603, 32576, 2503, 32591, 2404, 32605, 2305,
+  32619, 2205, 32632, 2105, 32645, 2006, 32657, 1906, 32668, 1806, 32679, 1706,
+  32689, 1606, 32699, 1506, 32708, 1406, 32716, 1306, 32724, 1205, 32731, 1105,
+  32737, 1005, 32743, 904, 32748, 804, 32753, 704, 32757, 603, 32760, 503,
+  32763, 402, 32765, 302, 32767, 201, 32767, 101, 32767, 0, 32767, -101,
+  32767, -201, 32765, -302, 32763, -402, 32760, -503, 32757, -603, 32753, -704,
+  32748, -804, 32743, -904, 32737, -1005, 32731, -1105, 32724, -1205, 32716, -1306,
+  32708, -1406, 32699, -1506, 32689, -1606, 32679, -1706, 32668, -1806, 32657, -1906,
+  32645, -2006, 32632, -2105, 32619, -2205, 32605, -2305, 32591, -2404, 32576, -2503,
+  32560, -2603, 32544, -2702, 32527, -2801, 32509, -2900, 32491, -2999, 32472, -3098,
+  32453, -3196, 32433, -3295, 32413, -3393, 32392, -3492, 32370, -3590, 32348, -3688,
+  32325, -3786, 32301, -3883, 32277, -3981, 32252, -4078, 32227, -4176, 32201, -4273,
+  32175, -4370, 32147, -4467, 32120, -4563, 32091, -4660, 32063, -4756, 32033, -4852,
+  32003, -4948, 31972, -5044, 31941, -5139, 31909, -5235, 31877, -5330, 31844, -5425,
+  31810, -5520, 31776, -5614, 31741, -5708, 31706, -5803, 31670, -5897, 31634, -5990,
+  31597, -6084, 31559, -6177, 31521, -6270, 31482, -6363, 31443, -6455, 31403, -6547,
+  31362, -6639, 31321, -6731, 31280, -6823, 31238, -6914, 31195, -7005, 31152, -7096,
+  31108, -7186, 31064, -7276, 31019, -7366, 30973, -7456, 30927, -7545, 30881, -7635,
+  30833, -7723, 30786, -7812, 30738, -7900, 30689, -7988, 30640, -8076, 30590, -8163,
+  30539, -8250, 30488, -8337, 30437, -8423, 30385, -8509, 30333, -8595, 30280, -8680,
+  30226, -8765, 30172, -8850, 30117, -8935, 30062, -9019, 30007, -9102, 29951, -9186,
+  29894, -9269, 29837, -9352, 29779, -9434, 29721, -9516, 29663, -9598, 29603, -9679,
+  29544, -9760, 29484, -9841, 29423, -9921, 29362, -10001, 29300, -10080, 29238, -10159,
+  29176, -10238, 29113, -10316, 29049, -10394, 28985, -10471, 28921, -10549, 28856, -10625,
+  28790, -10702, 28724, -10778, 28658, -10853, 28591, -10928, 28524, -11003, 28456, -11077,
+  28388, -11151, 28319, -11224, 28250, -11297, 28181, -11370, 28111, -11442, 28040, -11514,
+  27969, -11585, 27898, -11656, 27826, -11727, 27754, -11797, 27681, -11866, 27608, -11935,
+  27535, -12004, 27461, -12072, 27387, -12140, 27312, -12207, 27237, -12274, 27162, -12340,
+  27086, -12406, 27009, -12472, 26933, -12537, 26855, -12601, 26778, -12665, 26700, -12729,
+  26622, -12792, 26543, -12854, 26464, -12916, 26385, -12978, 26305, -13039, 26225, -13100,
+  26144, -13160, 26063, -13219, 25982, -13279, 25900, -13337, 25818, -13395, 25736, -13453,
+  25653, -13510, 25570, -13567, 25486, -13623, 25403, -13678, 25319, -13733, 25234, -13788,
+  25149, -13842, 25064, -13896, 24979, -13949, 24893, -14001, 24807, -14053, 24721, -14104,
+  24634, -14155, 24547, -14206, 24460, -14256, 24372, -14305, 24284, -14354, 24196, -14402,
+  24107, -14449, 24019, -14497, 23929, -14543, 23840, -14589, 23750, -14635, 23660, -14680,
+  23570, -14724, 23480, -14768, 23389, -14811, 23298, -14854, 23207, -14896, 23115, -14937,
+  23023, -14978, 22931, -15019, 22839, -15059, 22747, -15098, 22654, -15137, 22561, -15175,
+  22468, -15213, 22374, -15250, 22281, -15286, 22187, -15322, 22092, -15357, 21998, -15392,
+  21904, -15426, 21809, -15460, 21714, -15493, 21619, -15525, 21523, -15557, 21428, -15588,
+  21332, -15619, 21236, -15649, 21140, -15679, 21044, -15707, 20947, -15736, 20851, -15763,
+  20754, -15791, 20657, -15817, 20560, -15843, 20462, -15868, 20365, -15893, 20267, -15917,
+  20170, -15941, 20072, -15964, 19974, -15986, 19876, -16008, 19777, -16029, 19679, -16049,
+  19580, -16069, 19482, -16088, 19383, -16107, 19284, -16125, 19185, -16143, 19086, -16160,
+  18987, -16176, 18887, -16192, 18788, -16207, 18689, -16221, 18589, -16235, 18489, -16248,
+  18390, -16261, 18290, -16273, 18190, -16284, 18090, -16295, 17990, -16305, 17890, -16315,
+  17790, -16324, 17690, -16332, 17589, -16340, 17489, -16347, 17389, -16353, 17288, -16359,
+  17188, -16364, 17088, -16369, 16987, -16373, 16887, -16376, 16786, -16379, 16686, -16381,
+  16585, -16383, 16485, -16384,
+};
+
+#elif SL_ML_FFT_MAX_LENGTH == 2048
+
+const int16_t sli_ml_fft_real_coeff_a[2048] = {
+  16384, -16384, 16334, -16384, 16283, -16384, 16233, -16383, 16183, -16383, 16133, -16382,
+  16082, -16381, 16032, -16380, 15982, -16379, 15932, -16378, 15881, -16376, 15831, -16375,
+  15781, -16373, 15731, -16371, 15680, -16369, 15630, -16367, 15580, -16364, 15530, -16362,
+  15480, -16359, 15429, -16356, 15379, -16353, 15329, -16350, 15279, -16347, 15229, -16343,
+  15179, -16340, 15129, -16336, 15078, -16332, 15028, -16328, 14978, -16324, 14928, -16319,
+  14878, -16315, 14828, -16310, 14778, -16305, 14728, -16300, 14678, -16295, 14628, -16290,
+  14578, -16284, 14528, -16279, 14478, -16273, 14428, -16267, 14378, -16261, 14329, -16255,
+  14279, -16248, 14229, -16242, 14179, -16235, 14129, -16228, 14079, -16221, 14030, -16214,
+  13980, -16207, 13930, -16199, 13881, -16192, 13831, -16184, 13781, -16176, 13732, -16168,
+  13682, -16160, 13632, -16151, 13583, -16143, 13533, -16134, 13484, -16125, 13435, -16116,
+  13385, -16107, 13336, -16098, 13286, -16088, 13237, -16079, 13188, -16069, 13138, -16059,
+  13089, -16049, 13040, -16039, 12991, -16029, 12942, -16018, 12892, -16008, 12843, -15997,
+  12794, -15986, 12745, -15975, 12696, -15964, 12647, -15952, 12598, -15941, 12549, -15929,
+  12501, -15917, 12452, -15905, 12403, -15893, 12354, -15881, 12306, -15868, 12257, -15856,
+  12208, -15843, 12160, -15830, 12111, -15817, 12063, -15804, 12014, -15791, 11966, -15777,
+  11917, -15763, 11869, -15750, 11821, -15736, 11772, -15722, 11724, -15707, 11676, -15693,
+  11628, -15679, 11580, -15664, 11532, -15649, 11484, -15634, 11436, -15619, 11388, -15604,
+  11340, -15588, 11292, -15573, 11245, -15557, 11197, -15541, 11149, -15525, 11102, -15509,
+  11054, -15493, 11007, -15476, 10959, -15460, 10912, -15443, 10864, -15426, 10817, -15409,
+  10770, -15392, 10723, -15375, 10676, -15357, 10628, -15340, 10581, -15322, 10534, -15304,
+  10487, -15286, 10441, -15268, 10394, -15250, 10347, -15231, 10300, -15213, 10254, -15194,
+  10207, -15175, 10161, -15156, 10114, -15137, 10068, -15118, 10021, -15098, 9975, -15078,
+  9929, -15059, 9883, -15039, 9837, -15019, 9791, -14999, 9745, -14978, 9699, -14958,
+  9653, -14937, 9607, -14917, 9561, -14896, 9516, -14875, 9470, -14854, 9424, -14832,
+  9379, -14811, 9334, -14789, 9288, -14768, 9243, -14746, 9198, -14724, 9153, -14702,
+  9108, -14680, 9063, -14657, 9018, -14635, 8973, -14612, 8928, -14589, 8883, -14566,
+  8839, -14543, 8794, -14520, 8749, -14497, 8705, -14473, 8661, -14449, 8616, -14426,
+  8572, -14402, 8528, -14378, 8484, -14354, 8440, -14329, 8396, -14305, 8352, -14280,
+  8308, -14256, 8265, -14231, 8221, -14206, 8177, -14181, 8134, -14155, 8091, -14130,
+  8047, -14104, 8004, -14079, 7961, -14053, 7918, -14027, 7875, -14001, 7832, -13975,
+  7789, -13949, 7746, -13922, 7704, -13896, 7661, -13869, 7619, -13842, 7576, -13815,
+  7534, -13788, 7492, -13761, 7449, -13733, 7407, -13706, 7365, -13678, 7323, -13651,
+  7282, -13623, 7240, -13595, 7198, -13567, 7157, -13538, 7115, -13510, 7074, -13482,
+  7032, -13453, 6991, -13424, 6950, -13395, 6909, -13366, 6868, -13337, 6827, -13308,
+  6786, -13279, 6746, -13249, 6705, -13219, 6664, -13190, 6624, -13160, 6584, -13130,
+  6543, -13100, 6503, -13069, 6463, -13039, 6423, -13008, 6383, -12978, 6344, -12947,
+  6304, -12916, 6264, -12885, 6225, -12854, 6186, -12823, 6146, -12792, 6107, -12760,
+  6068, -12729, 6029, -12697, 5990, -12665, 5951, -12633, 5913, -12601, 5874, -12569,
+  5835, -12537, 5797, -12504, 5759, -12472, 5721, -12439, 5682, -12406, 5644, -12373,
+  5606, -12340, 5569, -12307, 5531, -12274, 5493, -12240, 5456, -12207, 5418, -12173,
+  5381, -12140, 5344, -12106, 5307, -12072, 5270, -12038, 5233, -12004, 5196, -11970,
+  5160, -11935, 5123, -11901, 5087, -11866, 5050, -11831, 5014, -11797, 4978, -11762,
+  4942, -11727, 4906, -11691, 4870, -11656, 4834, -11621, 4799, -11585, 4763, -11550,
+  4728, -11514, 4693, -11478, 4657, -11442, 4622, -11406, 4587, -11370, 4553, -11334,
+  4518, -11297, 4483, -11261, 4449, -11224, 4414, -11188, 4380, -11151, 4346, -11114,
+  4312, -11077, 4278, -11040, 4244, -11003, 4211, -10966, 4177, -10928, 4144, -10891,
+  4110, -10853, 4077, -10815, 4044, -10778, 4011, -10740, 3978, -10702, 3945, -10663,
+  3912, -10625, 3880, -10587, 3847, -10549, 3815, -10510, 3783, -10471, 3751, -10433,
+  3719, -10394, 3687, -10355, 3655, -10316, 3624, -10277, 3592, -10238, 3561, -10198,
+  3530, -10159, 3499, -10120, 3468, -10080, 3437, -10040, 3406, -10001, 3376, -9961,
+  3345, -9921, 3315, -9881, 3284, -9841, 3254, -9800, 3224, -9760, 3194, -9720,
+  3165, -9679, 3135, -9638, 3105, -9598, 3076, -9557, 3047, -9516, 3018, -9475,
+  2989, -9434, 2960, -9393, 2931, -9352, 2902, -9310, 2874, -9269, 2846, -9227,
+  2817, -9186, 2789, -9144, 2761, -9102, 2733, -9061, 2706, -9019, 2678, -8977,
+  2651, -8935, 2623, -8892, 2596, -8850, 2569, -8808, 2542, -8765, 2515, -8723,
+  2488, -8680, 2462, -8638, 2435, -8595, 2409, -8552, 2383, -8509, 2357, -8466,
+  2331, -8423, 2305, -8380, 2280, -8337, 2254, -8293, 2229, -8250, 2203, -8207,
+  2178, -8163, 2153, -8119, 2128, -8076, 2104, -8032, 2079, -7988, 2055, -7944,
+  2030, -7900, 2006, -7856, 1982, -7812, 1958, -7768, 1935, -7723, 1911, -7679,
+  1887, -7635, 1864, -7590, 1841, -7545, 1818, -7501, 1795, -7456, 1772, -7411,
+  1749, -7366, 1727, -7321, 1704, -7276, 1682, -7231, 1660, -7186, 1638, -7141,
+  1616, -7096, 1595, -7050, 1573, -7005, 1552, -6960, 1530, -6914, 1509, -6868,
+  1488, -6823, 1467, -6777, 1447, -6731, 1426, -6685, 1406, -6639, 1385, -6593,
+  1365, -6547, 1345, -6501, 1325, -6455, 1306, -6409, 1286, -6363, 1266, -6316,
+  1247, -6270, 1228, -6223, 1209, -6177, 1190, -6130, 1171, -6084, 1153, -6037,
+  1134, -5990, 1116, -5943, 1098, -5897, 1080, -5850, 1062, -5803, 1044, -5756,
+  1027, -5708, 1009, -5661, 992, -5614, 975, -5567, 958, -5520, 941, -5472,
+  924, -5425, 908, -5377, 891, -5330, 875, -5282, 859, -5235, 843, -5187,
+  827, -5139, 811, -5092, 796, -5044, 780, -4996, 765, -4948, 750, -4900,
+  735, -4852, 720, -4804, 705, -4756, 691, -4708, 677, -4660, 662, -4612,
+  648, -4563, 634, -4515, 621, -4467, 607, -4418, 593, -4370, 580, -4321,
+  567, -4273, 554, -4224, 541, -4176, 528, -4127, 516, -4078, 503, -4030,
+  491, -3981, 479, -3932, 467, -3883, 455, -3835, 443, -3786, 432, -3737,
+  420, -3688, 409, -3639, 398, -3590, 387, -3541, 376, -3492, 366, -3442,
+  355, -3393, 345, -3344, 335, -3295, 325, -3246, 315, -3196, 305, -3147,
+  296, -3098, 286, -3048, 277, -2999, 268, -2949, 259, -2900, 250, -2851,
+  241, -2801, 233, -2752, 224, -2702, 216, -2652, 208, -2603, 200, -2553,
+  192, -2503, 185, -2454, 177, -2404, 170, -2354, 163, -2305, 156, -2255,
+  149, -2205, 142, -2155, 136, -2105, 129, -2055, 123, -2006, 117, -1956,
+  111, -1906, 105, -1856, 100, -1806, 94, -1756, 89, -1706, 84, -1656,
+  79, -1606, 74, -1556, 69, -1506, 65, -1456, 60, -1406, 56, -1356,
+  52, -1306, 48, -1255, 44, -1205, 41, -1155, 37, -1105, 34, -1055,
+  31, -1005, 28, -955, 25, -904, 22, -854, 20, -804, 17, -754,
+  15, -704, 13, -653, 11, -603, 9, -553, 8, -503, 6, -452,
+  5, -402, 4, -352, 3, -302, 2, -251, 1, -201, 1, -151,
+  0, -101, 0, -50, 0, 0, 0, 50, 0, 101, 1, 151,
+  1, 201, 2, 251, 3, 302, 4, 352, 5, 402, 6, 452,
+  8, 503, 9, 553, 11, 603, 13, 653, 15, 704, 17, 754,
+  20, 804, 22, 854, 25, 904, 28, 955, 31, 1005, 34, 1055,
+  37, 1105, 41, 1155, 44, 1205, 48, 1255, 52, 1306, 56, 1356,
+  60, 1406, 65, 1456, 69, 1506, 74, 1556, 79, 1606, 84, 1656,
+  89, 1706, 94, 1756, 100, 1806, 105, 1856, 111, 1906, 117, 1956,
+  123, 2006, 129, 2055, 136, 2105, 142, 2155, 149, 2205, 156, 2255,
+  163, 2305, 170, 2354, 177, 2404, 185, 2454, 192, 2503, 200, 2553,
+  208, 2603, 216, 2652, 224, 2702, 233, 2752, 241, 2801, 250, 2851,
+  259, 2900, 268, 2949, 277, 2999, 286, 3048, 296, 3098, 305, 3147,
+  315, 3196, 325, 3246, 335, 3295, 345, 3344, 355, 3393, 366, 3442,
+  376, 3492, 387, 3541, 398, 3590, 409, 3639, 420, 3688, 432, 3737,
+  443, 3786, 455, 3835, 467, 3883, 479, 3932, 491, 3981, 503, 4030,
+  516, 4078, 528, 4127, 541, 4176, 554, 4224, 567, 4273, 580, 4321,
+  593, 4370, 607, 4418, 621, 4467, 634, 4515, 648, 4563, 662, 4612,
+  677, 4660, 691, 4708, 705, 4756, 720, 4804, 735, 4852, 750, 4900,
+  765, 4948, 780, 4996, 796, 5044, 811, 5092, 827, 5139, 843, 5187,
+  859, 5235, 875, 5282, 891, 5330, 908, 5377, 924, 5425, 941, 5472,
+  958, 5520, 975, 5567, 992, 5614, 1009, 5661, 1027, 5708, 1044, 5756,
+  1062, 5803, 1080, 5850, 1098, 5897, 1116, 5943, 1134, 5990, 1153, 6037,
+  1171, 6084, 1190, 6130, 1209, 6177, 1228, 6223, 1247, 6270, 1266, 6316,
+  1286, 6363, 1306, 6409, 1325, 6455, 1345, 6501, 1365, 6547, 1385, 6593,
+  1406, 6639, 1426, 6685, 1447, 6731, 1467, 6777, 1488, 6823, 1509, 6868,
+  1530, 6914, 1552, 6960, 1573, 7005, 1595, 7050, 1616, 7096, 1638, 7141,
+  1660, 7186, 1682, 7231, 1704, 7276, 1727, 7321, 1749, 7366, 1772, 7411,
+  1795, 7456, 1818, 7501, 1841, 7545, 1864, 7590, 1887, 7635, 1911, 7679,
+  1935, 7723, 1958, 7768, 1982, 7812, 2006, 7856, 2030, 7900, 2055, 7944,
+  2079, 7988, 2104, 8032, 2128, 8076, 2153, 8119, 2178, 8163, 2203, 8207,
+  2229, 8250, 2254, 8293, 2280, 8337, 2305, 8380, 2331, 8423, 2357, 8466,
+  2383, 8509, 2409, 8552, 2435, 8595, 2462, 8638, 2488, 8680, 2515, 8723,
+  2542, 8765, 2569, 8808, 2596, 8850, 2623, 8892, 2651, 8935, 2678, 8977,
+  2706, 9019, 2733, 9061, 2761, 9102, 2789, 9144, 2817, 9186, 2846, 9227,
+  2874, 9269, 2902, 9310, 2931, 9352, 2960, 9393, 2989, 9434, 3018, 9475,
+  3047, 9516, 3076, 9557, 3105, 9598, 3135, 9638, 3165, 9679, 3194, 9720,
+  3224, 9760, 3254, 9800, 3284, 9841, 3315, 9881, 3345, 9921, 3376, 9961,
+  3406, 10001, 3437, 10040, 3468, 10080, 3499, 10120, 3530, 10159, 3561, 10198,
+  3592, 10238, 3624, 10277, 3655, 10316, 3687, 10355, 3719, 10394, 3751, 10433,
+  3783, 10471, 3815, 10510, 3847, 10549, 3880, 10587, 3912, 10625, 3945, 10663,
+  3978, 10702, 4011, 10740, 4044, 10778, 4077, 10815, 4110, 10853, 4144, 10891,
+  4177, 10928, 4211, 10966, 4244, 11003, 4278, 11040, 4312, 11077, 4346, 11114,
+  4380, 11151, 4414, 11188, 4449, 11224, 4483, 11261, 4518, 11297, 4553, 11334,
+  4587, 11370, 4622, 11406, 4657, 11442, 4693, 11478, 4728, 11514, 4763, 11550,
+  4799, 11585, 4834, 11621, 4870, 11656, 4906, 11691, 4942, 11727, 4978, 11762,
+  5014, 11797, 5050, 11831, 5087, 11866, 5123, 11901, 5160, 11935, 5196, 11970,
+  5233, 12004, 5270, 12038, 5307, 12072, 5344, 12106, 5381, 12140, 5418, 12173,
+  5456, 12207, 5493, 12240, 5531, 12274, 5569, 12307, 5606, 12340, 5644, 12373,
+  5682, 12406, 5721, 12439, 5759, 12472, 5797, 12504, 5835, 12537, 5874, 12569,
+  5913, 12601, 5951, 12633, 5990, 12665, 6029, 12697, 6068, 12729, 6107, 12760,
+  6146, 12792, 6186, 12823, 6225, 12854, 6264, 12885, 6304, 12916, 6344, 12947,
+  6383, 12978, 6423, 13008, 6463, 13039, 6503, 13069, 6543, 13100, 6584, 13130,
+  6624, 13160, 6664, 13190, 6705, 13219, 6746, 13249, 6786, 13279, 6827, 13308,
+  6868, 13337, 6909, 13366, 6950, 13395, 6991, 13424, 7032, 13453, 7074, 13482,
+  7115, 13510, 7157, 13538, 7198, 13567, 7240, 13595, 7282, 13623, 7323, 13651,
+  7365, 13678, 7407, 13706, 7449, 13733, 7492, 13761, 7534, 13788, 7576, 13815,
+  7619, 13842, 7661, 13869, 7704, 13896, 7746, 13922, 7789, 13949, 7832, 13975,
+  7875, 14001, 7918, 14027, 7961, 14053, 8004, 14079, 8047, 14104, 8091, 14130,
+  8134, 14155, 8177, 14181, 8221, 14206, 8265, 14231, 8308, 14256, 8352, 14280,
+  8396, 14305, 8440, 14329, 8484, 14354, 8528, 14378, 8572, 14402, 8616, 14426,
+  8661, 14449, 8705, 14473, 8749, 14497, 8794, 14520, 8839, 14543, 8883, 14566,
+  8928, 14589, 8973, 14612, 9018, 14635, 9063, 14657, 9108, 14680, 9153, 14702,
+  9198, 14724, 9243, 14746, 9288, 14768, 9334, 14789, 9379, 14811, 9424, 14832,
+  9470, 14854, 9516, 14875, 9561, 14896, 9607, 14917, 9653, 14937, 9699, 14958,
+  9745, 14978, 9791, 14999, 9837, 15019, 9883, 15039, 9929, 15059, 9975, 15078,
+  10021, 15098, 10068, 15118, 10114, 15137, 10161, 15156, 10207, 15175, 10254, 15194,
+  10300, 15213, 10347, 15231, 10394, 15250, 10441, 15268, 10487, 15286, 10534, 15304,
+  10581, 15322, 10628, 15340, 10676, 15357, 10723, 15375, 10770, 15392, 10817, 15409,
+  10864, 15426, 10912, 15443, 10959, 15460, 11007, 15476, 11054, 15493, 11102, 15509,
+  11149, 15525, 11197, 15541, 11245, 15557, 11292, 15573, 11340, 15588, 11388, 15604,
+  11436, 15619, 11484, 15634, 11532, 15649, 11580, 15664, 11628, 15679, 11676, 15693,
+  11724, 15707, 11772, 15722, 11821, 15736, 11869, 15750, 11917, 15763, 11966, 15777,
+  12014, 15791, 12063, 15804, 12111, 15817, 12160, 15830, 12208, 15843, 12257, 15856,
+  12306, 15868, 12354, 15881, 12403, 15893, 12452, 15905, 12501, 15917, 12549, 15929,
+  12598, 15941, 12647, 15952, 12696, 15964, 12745, 15975, 12794, 15986, 12843, 15997,
+  12892, 16008, 12942, 16018, 12991, 16029, 13040, 16039, 13089, 16049, 13138, 16059,
+  13188, 16069, 13237, 16079, 13286, 16088, 13336, 16098, 13385, 16107, 13435, 16116,
+  13484, 16125, 13533, 16134, 13583, 16143, 13632, 16151, 13682, 16160, 13732, 16168,
+  13781, 16176, 13831, 16184, 13881, 16192, 13930, 16199, 13980, 16207, 14030, 16214,
+  14079, 16221, 14129, 16228, 14179, 16235, 14229, 16242, 14279, 16248, 14329, 16255,
+  14378, 16261, 14428, 16267, 14478, 16273, 14528, 16279, 14578, 16284, 14628, 16290,
+  14678, 16295, 14728, 16300, 14778, 16305, 14828, 16310, 14878, 16315, 14928, 16319,
+  14978, 16324, 15028, 16328, 15078, 16332, 15129, 16336, 15179, 16340, 15229, 16343,
+  15279, 16347, 15329, 16350, 15379, 16353, 15429, 16356, 15480, 16359, 15530, 16362,
+  15580, 16364, 15630, 16367, 15680, 16369, 15731, 16371, 15781, 16373, 15831, 16375,
+  15881, 16376, 15932, 16378, 15982, 16379, 16032, 16380, 16082, 16381, 16133, 16382,
+  16183, 16383, 16233, 16383, 16283, 16384, 16334, 16384,
+};
+
+const int16_t sli_ml_fft_real_coeff_b[2048] = {
+  16384, 16384, 16434, 16384, 16485, 16384, 16535, 16383, 16585, 16383, 16635, 16382,
+  16686, 16381, 16736, 16380, 16786, 16379, 16836, 16378, 16887, 16376, 16937, 16375,
+  16987, 16373, 17037, 16371, 17088, 16369, 17138, 16367, 17188, 16364, 17238, 16362,
+  17288, 16359, 17339, 16356, 17389, 16353, 17439, 16350, 17489, 16347, 17539, 16343,
+  17589, 16340, 17639, 16336, 17690, 16332, 17740, 16328, 17790, 16324, 17840, 16319,
+  17890, 16315, 17940, 16310, 17990, 16305, 18040, 16300, 18090, 16295, 18140, 16290,
+  18190, 16284, 18240, 16279, 18290, 16273, 18340, 16267, 18390, 16261, 18439, 16255,
+  18489, 16248, 18539, 16242, 18589, 16235, 18639, 16228, 18689, 16221, 18738, 16214,
+  18788, 16207, 18838, 16199, 18887, 16192, 18937, 16184, 18987, 16176, 19036, 16168,
+  19086, 16160, 19136, 16151, 19185, 16143, 19235, 16134, 19284, 16125, 19333, 16116,
+  19383, 16107, 19432, 16098, 19482, 16088, 19531, 16079, 19580, 16069, 19630, 16059,
+  19679, 16049, 19728, 16039, 19777, 16029, 19826, 16018, 19876, 16008, 19925, 15997,
+  19974, 15986, 20023, 15975, 20072, 15964, 20121, 15952, 20170, 15941, 20219, 15929,
+  20267, 15917, 20316, 15905, 20365, 15893, 20414, 15881, 20462, 15868, 20511, 15856,
+  20560, 15843, 20608, 15830, 20657, 15817, 20705, 15804, 20754, 15791, 20802, 15777,
+  20851, 15763, 20899, 15750, 20947, 15736, 20996, 15722, 21044, 15707, 21092, 15693,
+  21140, 15679, 21188, 15664, 21236, 15649, 21284, 15634, 21332, 15619, 21380, 15604,
+  21428, 15588, 21476, 15573, 21523, 15557, 21571, 15541, 21619, 15525, 21666, 15509,
+  21714, 15493, 21761, 15476, 21809, 15460, 21856, 15443, 21904, 15426, 21951, 15409,
+  21998, 15392, 22045, 15375, 22092, 15357, 22140, 15340, 22187, 15322, 22234, 15304,
+  22281, 15286, 22327, 15268, 22374, 15250, 22421, 15231, 22468, 15213, 22514, 15194,
+  22561, 15175, 22607, 15156, 22654, 15137, 22700, 15118, 22747, 15098, 22793, 15078,
+  22839, 15059, 22885, 15039, 22931, 15019, 22977, 14999, 23023, 14978, 23069, 14958,
+  23115, 14937, 23161, 14917, 23207, 14896, 23252, 14875, 23298, 14854, 23344, 14832,
+  23389, 14811, 23434, 14789, 23480, 14768, 23525, 14746, 23570, 14724, 23615, 14702,
+  23660, 14680, 23705, 14657, 23750, 14635, 23795, 14612, 23840, 14589, 23885, 14566,
+  23929, 14543, 23974, 14520, 24019, 14497, 24063, 14473, 24107, 14449, 24152, 14426,
+  24196, 14402, 24240, 14378, 24284, 14354, 24328, 14329, 24372, 14305, 24416, 14280,
+  24460, 14256, 24503, 14231, 24547, 14206, 24591, 14181, 24634, 14155, 24677, 14130,
+  24721, 14104, 24764, 14079, 24807, 14053, 24850, 14027, 24893, 14001, 24936, 13975,
+  24979, 13949, 25022, 13922, 25064, 13896, 25107, 13869, 25149, 13842, 25192, 13815,
+  25234, 13788, 25276, 13761, 25319, 13733, 25361, 13706, 25403, 13678, 25445, 13651,
+  25486, 13623, 25528, 13595, 25570, 13567, 25611, 13538, 25653, 13510, 25694, 13482,
+  25736, 13453, 25777, 13424, 25818, 13395, 25859, 13366, 25900, 13337, 25941, 13308,
+  25982, 13279, 26022, 13249, 26063, 13219, 26104, 13190, 26144, 13160, 26184, 13130,
+  26225, 13100, 26265, 13069, 26305, 13039, 26345, 13008, 26385, 12978, 26424, 12947,
+  26464, 12916, 26504, 12885, 26543, 12854, 26582, 12823, 26622, 12792, 26661, 12760,
+  26700, 12729, 26739, 12697, 26778, 12665, 26817, 12633, 26855, 12601, 26894, 12569,
+  26933, 12537, 26971, 12504, 27009, 12472, 27047, 12439, 27086, 12406, 27124, 12373,
+  27162, 12340, 27199, 12307, 27237, 12274, 27275, 12240, 27312, 12207, 27350, 12173,
+  27387, 12140, 27424, 12106, 27461, 12072, 27498, 12038, 27535, 12004, 27572, 11970,
+  27608, 11935, 27645, 11901, 27681, 11866, 27718, 11831, 27754, 11797, 27790, 11762,
+  27826, 11727, 27862, 11691, 27898, 11656, 27934, 11621, 27969, 11585, 28005, 11550,
+  28040, 11514, 28075, 11478, 28111, 11442, 28146, 11406, 28181, 11370, 28215, 11334,
+  28250, 11297, 28285, 11261, 28319, 11224, 28354, 11188, 28388, 11151, 28422, 11114,
+  28456, 11077, 28490, 11040, 28524, 11003, 28557, 10966, 28591, 10928, 28624, 10891,
+  28658, 10853, 28691, 10815, 28724, 10778, 28757, 10740, 28790, 10702, 28823, 10663,
+  28856, 10625, 28888, 10587, 28921, 10549, 28953, 10510, 28985, 10471, 29017, 10433,
+  29049, 10394, 29081, 10355, 29113, 10316, 29144, 10277, 29176, 10238, 29207, 10198,
+  29238, 10159, 29269, 10120, 29300, 10080, 29331, 10040, 29362, 10001, 29392, 9961,
+  29423, 9921, 29453, 9881, 29484, 9841, 29514, 9800, 29544, 9760, 29574, 9720,
+  29603, 9679, 29633, 9638, 29663, 9598, 29692, 9557, 29721, 9516, 29750, 9475,
+  29779, 9434, 29808, 9393, 29837, 9352, 29866, 9310, 29894, 9269, 29922, 9227,
+  29951, 9186, 29979, 9144, 30007, 9102, 30035, 9061, 30062, 9019, 30090, 8977,
+  30117, 8935, 30145, 8892, 30172, 8850, 30199, 8808, 30226, 8765, 30253, 8723,
+  30280, 8680, 30306, 8638, 30333, 8595, 30359, 8552, 30385, 8509, 30411, 8466,
+  30437, 8423, 30463, 8380, 30488, 8337, 30514, 8293, 30539, 8250, 30565, 8207,
+  30590, 8163, 30615, 8119, 30640, 8076, 30664, 8032, 30689, 7988, 30713, 7944,
+  30738, 7900, 30762, 7856, 30786, 7812, 30810, 7768, 30833, 7723, 30857, 7679,
+  30881, 7635, 30904, 7590, 30927, 7545, 30950, 7501, 30973, 7456, 30996, 7411,
+  31019, 7366, 31041, 7321, 31064, 7276, 31086, 7231, 31108, 7186, 31130, 7141,
+  31152, 7096, 31173, 7050, 31195, 7005, 31216, 6960, 31238, 6914, 31259, 6868,
+  31280, 6823, 31301, 6777, 31321, 6731, 31342, 6685, 31362, 6639, 31383, 6593,
+  31403, 6547, 31423, 6501, 31443, 6455, 31462, 6409, 31482, 6363, 31502, 6316,
+  31521, 6270, 31540, 6223, 31559, 6177, 31578, 6130, 31597, 6084, 31615, 6037,
+  31634, 5990, 31652, 5943, 31670, 5897, 31688, 5850, 31706, 5803, 31724, 5756,
+  31741, 5708, 31759, 5661, 31776, 5614, 31793, 5567, 31810, 5520, 31827, 5472,
+  31844, 5425, 31860, 5377, 31877, 5330, 31893, 5282, 31909, 5235, 31925, 5187,
+  31941, 5139, 31957, 5092, 31972, 5044, 31988, 4996, 32003, 4948, 32018, 4900,
+  32033, 4852, 32048, 4804, 32063, 4756, 32077, 4708, 32091, 4660, 32106, 4612,
+  32120, 4563, 32134, 4515, 32147, 4467, 32161, 4418, 32175, 4370, 32188, 4321,
+  32201, 4273, 32214, 4224, 32227, 4176, 32240, 4127, 32252, 4078, 32265, 4030,
+  32277, 3981, 32289, 3932, 32301, 3883, 32313, 3835, 32325, 3786, 32336, 3737,
+  32348, 3688, 32359, 3639, 32370, 3590, 32381, 3541, 32392, 3492, 32402, 3442,
+  32413, 3393, 32423, 3344, 32433, 3295, 32443, 3246, 32453, 3196, 32463, 3147,
+  32472, 3098, 32482, 3048, 32491, 2999, 32500, 2949, 32509, 2900, 32518, 2851,
+  32527, 2801, 32535, 2752, 32544, 2702, 32552, 2652, 32560, 2603, 32568, 2553,
+  32576, 2503, 32583, 2454, 32591, 2404, 32598, 2354, 32605, 2305, 32612, 2255,
+  32619, 2205, 32626, 2155, 32632, 2105, 32639, 2055, 32645, 2006, 32651, 1956,
+  32657, 1906, 32663, 1856, 32668, 1806, 32674, 1756, 32679, 1706, 32684, 1656,
+  32689, 1606, 32694, 1556, 32699, 1506, 32703, 1456, 32708, 1406, 32712, 1356,
+  32716, 1306, 32720, 1255, 32724, 1205, 32727, 1155, 32731, 1105, 32734, 1055,
+  32737, 1005, 32740, 955, 32743, 904, 32746, 854, 32748, 804, 32751, 754,
+  32753, 704, 32755, 653, 32757, 603, 32759, 553, 32760, 503, 32762, 452,
+  32763, 402, 32764, 352, 32765, 302, 32766, 251, 32767, 201, 32767, 151,
+  32767, 101, 32767, 50, 32767, 0, 32767, -50, 32767, -101, 32767, -151,
+  32767, -201, 32766, -251, 32765, -302, 32764, -352, 32763, -402, 32762, -452,
+  32760, -503, 32759, -553, 32757, -603, 32755, -653, 32753, -704, 32751, -754,
+  32748, -804, 32746, -854, 32743, -904, 32740, -955, 32737, -1005, 32734, -1055,
+  32731, -1105, 32727, -1155, 32724, -1205, 32720, -1255, 32716, -1306, 32712, -1356,
+  32708, -1406, 32703, -1456, 32699, -1506, 32694, -1556, 32689, -1606, 32684, -1656,
+  32679, -1706, 32674, -1756, 32668, -1806, 32663, -1856, 32657, -1906, 32651, -1956,
+  32645, -2006, 32639, -2055, 32632, -2105, 32626, -2155, 32619, -2205, 32612, -2255,
+  32605, -2305, 32598, -2354, 32591, -2404, 32583, -2454, 32576, -2503, 32568, -2553,
+  32560, -2603, 32552, -2652, 32544, -2702, 32535, -2752, 32527, -2801, 32518, -2851,
+  32509, -2900, 32500, -2949, 32491, -2999, 32482, -3048, 32472, -3098, 32463, -3147,
+  32453, -3196, 32443, -3246, 32433, -3295, 32423, -3344, 32413, -3393, 32402, -3442,
+  32392, -3492, 32381, -3541, 32370, -3590, 32359, -3639, 32348, -3688, 32336, -3737,
+  32325, -3786, 32313, -3835, 32301, -3883, 32289, -3932, 32277, -3981, 32265, -4030,
+  32252, -4078, 32240, -4127, 32227, -4176, 32214, -4224, 32201, -4273, 32188, -4321,
+  32175, -4370, 32161, -4418, 32147, -4467, 32134, -4515, 32120, -4563, 32106, -4612,
+  32091, -4660, 32077, -4708, 32063, -4756, 32048, -4804, 32033, -4852, 32018, -4900,
+  32003, -4948, 31988, -4996, 31972, -5044, 31957, -5092, 31941, -5139, 31925, -5187,
+  31909, -5235, 31893, -5282, 31877, -5330, 31860, -5377, 31844, -5425, 31827, -5472,
+  31810, -5520, 31793, -5567, 31776, -5614, 31759, -5661, 31741, -5708, 31724, -5756,
+  31706, -5803, 31688, -5850, 31670, -5897, 31652, -5943, 31634, -5990, 31615, -6037,
+  31597, -6084, 31578, -6130, 31559, -6177, 31540, -6223, 31521, -6270, 31502, -6316,
+  31482, -6363, 31462, -6409, 31443, -6455, 31423, -6501, 31403, -6547, 31383, -6593,
+  31362, -6639, 31342, -6685, 31321, -6731, 31301, -6777, 31280, -6823, 31259, -6868,
+  31238, -6914, 31216, -6960, 31195, -7005, 31173, -7050, 31152, -7096, 31130, -7141,
+  31108, -7186, 31086, -7231, 31064, -7276, 31041, -7321, 31019, -7366, 30996, -7411,
+  30973, -7456, 30950, -7501, 30927, -7545, 30904, -7590, 30881, -7635, 30857, -7679,
+  30833, -7723, 30810, -7768, 30786, -7812, 30762, -7856, 30738, -7900, 30713, -7944,
+  30689, -7988, 30664, -8032, 30640, -8076, 30615, -8119, 30590, -8163, 30565, -8207,
+  30539, -8250, 30514, -8293, 30488, -8337, 30463, -8380, 30437, -8423, 30411, -8466,
+  30385, -8509, 30359, -8552, 30333, -8595, 30306, -8638, 30280, -8680, 30253, -8723,
+  30226, -8765, 30199, -8808, 30172, -8850, 30145, -8892, 30117, -8935, 30090, -8977,
+  30062, -9019, 30035, -9061, 30007, -9102, 29979, -9144, 29951, -9186, 29922, -9227,
+  29894, -9269, 29866, -9310, 29837, -9352, 29808, -9393, 29779, -9434, 29750, -9475,
+  29721, -9516, 29692, -9557, 29663, -9598, 29633, -9638, 29603, -9679, 29574, -9720,
+  29544, -9760, 29514, -9800, 29484, -9841, 29453, -9881, 29423, -9921, 29392, -9961,
+  29362, -10001, 29331, -10040, 29300, -10080, 29269, -10120, 29238, -10159, 29207, -10198,
+  29176, -10238, 29144, -10277, 29113, -10316, 29081, -10355, 29049, -10394, 29017, -10433,
+  28985, -10471, 28953, -10510, 28921, -10549, 28888, -10587, 28856, -10625, 28823, -10663,
+  28790, -10702, 28757, -10740, 28724, -10778, 28691, -10815, 28658, -10853, 28624, -10891,
+  28591, -10928, 28557, -10966, 28524, -11003, 28490, -11040, 28456, -11077, 28422, -11114,
+  28388, -11151, 28354, -11188, 28319, -11224, 28285, -11261, 28250, -11297, 28215, -11334,
+  28181, -11370, 28146, -11406, 28111, -11442, 28075, -11478, 28040, -11514, 28005, -11550,
+  27969, -11585, 27934, -11621, 27898, -11656, 27862, -11691, 27826, -11727, 27790, -11762,
+  27754, -11797, 27718, -11831, 27681, -11866, 27645, -11901, 27608, -11935, 27572, -11970,
+  27535, -12004, 27498, -12038, 27461, -12072, 27424, -12106, 27387, -12140, 27350, -12173,
+  27312, -12207, 27275, -12240, 27237, -12274, 27199, -12307, 27162, -12340, 27124, -12373,
+  27086, -12406, 27047, -12439, 27009, -12472, 26971, -12504, 26933, -12537, 26894, -12569,
+  26855, -12601, 26817, -12633, 26778, -12665, 26739, -12697, 26700, -12729, 26661, -12760,
+  26622, -12792, 26582, -12823, 26543, -12854, 26504, -12885, 26464, -12916, 26424, -12947,
+  26385, -12978, 26345, -13008, 26305, -13039, 26265, -13069, 26225, -13100, 26184, -13130,
+  26144, -13160, 26104, -13190, 26063, -13219, 26022, -13249, 25982, -13279, 25941, -13308,
+  25900, -13337, 25859, -13366, 25818, -13395, 25777, -13424, 25736, -13453, 25694, -13482,
+  25653, -13510, 25611, -13538, 25570, -13567, 25528, -13595, 25486, -13623, 25445, -13651,
+  25403, -13678, 25361, -13706, 25319, -13733, 25276, -13761, 25234, -13788, 25192, -13815,
+  25149, -13842, 25107, -13869, 25064, -13896, 25022, -13922, 24979, -13949, 24936, -13975,
+  24893, -14001, 24850, -14027, 24807, -14053, 24764, -14079, 24721, -14104, 24677, -14130,
+  24634, -14155, 24591, -14181, 24547, -14206, 24503, -14231, 24460, -14256, 24416, -14280,
+  24372, -14305, 24328, -14329, 24284, -14354, 24240, -14378, 24196, -14402, 24152, -14426,
+  24107, -14449, 24063, -14473, 24019, -14497, 23974, -14520, 23929, -14543, 23885, -14566,
+  23840, -14589, 23795, -14612, 23750, -14635, 23705, -14657, 23660, -14680, 23615, -14702,
+  23570, -14724, 23525, -14746, 23480, -14768, 23434, -14789, 23389, -14811, 23344, -14832,
+  23298, -14854, 23252, -14875, 23207, -14896, 23161, -14917, 23115, -14937, 23069, -14958,
+  23023, -14978, 22977, -14999, 22931, -15019, 22885, -15039, 22839, -15059, 22793, -15078,
+  22747, -15098, 22700, -15118, 22654, -15137, 22607, -15156, 22561, -15175, 22514, -15194,
+  22468, -15213, 22421, -15231, 22374, -15250, 22327, -15268, 22281, -15286, 22234, -15304,
+  22187, -15322, 22140, -15340, 22092, -15357, 22045, -15375, 21998, -15392, 21951, -15409,
+  21904, -15426, 21856, -15443, 21809, -15460, 21761, -15476, 21714, -15493, 21666, -15509,
+  21619, -15525, 21571, -15541, 21523, -15557, 21476, -15573, 21428, -15588, 21380, -15604,
+  21332, -15619, 21284, -15634, 21236, -15649, 21188, -15664, 21140, -15679, 21092, -15693,
+  21044, -15707, 20996, -15722, 20947, -15736, 20899, -15750, 20851, -15763, 20802, -15777,
+  20754, -15791, 20705, -15804, 20657, -15817, 20608, -15830, 20560, -15843, 20511, -15856,
+  20462, -15868, 20414, -15881, 20365, -15893, 20316, -15905, 20267, -15917, 20219, -15929,
+  20170, -15941, 20121, -15952, 20072, -15964, 20023, -15975, 19974, -15986, 19925, -15997,
+  19876, -16008, 19826, -16018, 19777, -16029, 19728, -16039, 19679, -16049, 19630, -16059,
+  19580, -16069, 19531, -16079, 19482, -16088, 19432, -16098, 19383, -16107, 19333, -16116,
+  19284, -16125, 19235, -16134, 19185, -16143, 19136, -16151, 19086, -16160, 19036, -16168,
+  18987, -16176, 18937, -16184, 18887, -16192, 18838, -16199, 18788, -16207, 18738, -16214,
+  18689, -16221, 18639, -16228, 18589, -16235, 18539, -16242, 18489, -16248, 18439, -16255,
+  18390, -16261, 18340, -16267, 18290, -16273, 18240, -16279, 18190, -16284, 18140, -16290,
+  18090, -16295, 18040, -16300, 17990, -16305, 17940, -16310, 17890, -16315, 17840, -16319,
+  17790, -16324, 17740, -16328, 17690, -16332, 17639, -16336, 17589, -16340, 17539, -16343,
+  17489, -16347, 17439, -16350, 17389, -16353, 17339, -16356, 17288, -16359, 17238, -16362,
+  17188, -16364, 17138, -16367, 17088, -16369, 17037, -16371, 16987, -16373, 16937, -16375,
+  16887, -16376, 16836, -16378, 16786, -16379, 16736, -16380, 16686, -16381, 16635, -16382,
+  16585, -16383, 16535, -16383, 16485, -16384, 16434, -16384,
+};
+
+#endif
@@ -0,0 +1,54 @@
+/***************************************************************************//**
+ * @file
+ * @brief SL_ML_FFT real coefficient tables
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_ML_FFT_TABLES_H
+#define SL_ML_FFT_TABLES_H
+
+#include <stdint.h>
+
+#include "sl_ml_fft_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SL_ML_FFT_MAX_LENGTH <= 2048
+/// Real coefficient tables of a SL_ML_FFT_MAX_LENGTH point real FFT,
+/// generated by tool/dsp/generate_fft_tables.py. Longer maximum lengths use
+/// the 8192 point tables of the CMSIS DSP library.
+extern const int16_t sli_ml_fft_real_coeff_a[SL_ML_FFT_MAX_LENGTH];
+extern const int16_t sli_ml_fft_real_coeff_b[SL_ML_FFT_MAX_LENGTH];
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // SL_ML_FFT_TABLES_H
@@ -27,12 +27,22 @@
  * 3. This notice may not be removed or altered from any source distribution.
  *
  ******************************************************************************/
+#include <string.h>
 #include "sl_status.h"
 #include "microfrontend/lib/frontend.h"
 #include "microfrontend/lib/frontend_util.h"
 #include "sl_ml_audio_feature_generation.h"
 #include "sl_ml_audio_feature_generation_config.h"
 #include "sl_common.h"
+#if defined(SL_CATALOG_TFLITE_MICRO_PRESENT)
+#include "sl_tflite_micro_streaming.h"
+#endif
+#ifndef SL_ML_AUDIO_FEATURE_GENERATION_CONST_TABLES_ENABLE
+#define SL_ML_AUDIO_FEATURE_GENERATION_CONST_TABLES_ENABLE 0
+#endif
+#if SL_ML_AUDIO_FEATURE_GENERATION_CONST_TABLES_ENABLE
+#include "sl_ml_frontend_tables.h"
+#endif
 
 /*******************************************************************************
  *********************************   DEFINES   *********************************
@@ -40,7 +50,24 @@
 #define AUDIO_BUFFER_CHUNK_SIZE     512
 #define AUDIO_BUFFER_SIZE           (SL_ML_AUDIO_FEATURE_GENERATION_AUDIO_BUFFER_SIZE)
 #define FEATURE_BUFFER_SLICE_COUNT  (1 + ((SL_ML_FRONTEND_SAMPLE_LENGTH_MS - SL_ML_FRONTEND_WINDOW_SIZE_MS) / SL_ML_FRONTEND_WINDOW_STEP_MS))
-#define FEATURE_BUFFER_SIZE         (SL_ML_FRONTEND_FILTERBANK_N_CHANNELS * FEATURE_BUFFER_SLICE_COUNT)
+#ifndef SL_ML_FRONTEND_DCT_ENABLE
+#define SL_ML_FRONTEND_DCT_ENABLE   0
+#define SL_ML_FRONTEND_DCT_N_COEFFICIENTS 13
+#endif
+#ifndef SL_ML_FRONTEND_ENERGY_GATE_ENABLE
+#define SL_ML_FRONTEND_ENERGY_GATE_ENABLE           0
+#define SL_ML_FRONTEND_ENERGY_GATE_THRESHOLD_RATIO  4.0
+#define SL_ML_FRONTEND_ENERGY_GATE_MIN_ENERGY       16.0
+#define SL_ML_FRONTEND_ENERGY_GATE_HANGOVER_FRAMES  10
+#endif
+// With the DCT enabled, a slice holds int16 cepstral coefficients instead of
+// the filterbank channels
+#if SL_ML_FRONTEND_DCT_ENABLE
+#define FEATURE_SLICE_SIZE          (SL_ML_FRONTEND_DCT_N_COEFFICIENTS)
+#else
+#define FEATURE_SLICE_SIZE          (SL_ML_FRONTEND_FILTERBANK_N_CHANNELS)
+#endif
+#define FEATURE_BUFFER_SIZE         (FEATURE_SLICE_SIZE * FEATURE_BUFFER_SLICE_COUNT)
 
 // Quantization constants
 // Feature range min and max, used for determining valid range to quantize from
@@ -68,6 +95,10 @@ static volatile size_t feature_buffer_start;
 // Counter to maintain number of new and available slices
 static size_t num_unfetched_slices = 0;
 
+// Number of slices shifted into the feature buffer since the last time a
+// tensor was filled, -1 if the whole feature buffer has changed
+static int num_slices_since_fill = -1;
+
 // Optional audio volume scaling factor
 static const int audio_volume_scaler = SL_ML_AUDIO_FEATURE_GENERATION_AUDIO_GAIN;
 
@@ -104,6 +135,13 @@ sl_status_t sl_ml_audio_feature_generation_frontend_init()
   // Window settings
   config.window.size_ms = SL_ML_FRONTEND_WINDOW_SIZE_MS;
   config.window.step_size_ms = SL_ML_FRONTEND_WINDOW_STEP_MS;
+#if SL_ML_AUDIO_FEATURE_GENERATION_FUSED_WINDOW_ENABLE
+  // The gain, DC notch filter and window are applied in a single pass
+  config.window.ring_buffer = 1;
+#else
+  config.window.ring_buffer = 0;
+#endif
+  config.window.input_gain = audio_volume_scaler;
 
   // Filterbank settings
   config.filterbank.num_channels = SL_ML_FRONTEND_FILTERBANK_N_CHANNELS;
@@ -130,7 +168,24 @@ sl_status_t sl_ml_audio_feature_generation_frontend_init()
   config.log_scale.enable_log = SL_ML_FRONTEND_LOG_SCALE_ENABLE;
   config.log_scale.scale_shift = SL_ML_FRONTEND_LOG_SCALE_SHIFT;
 
-  if (!FrontendPopulateState(&config, &frontend_state, SL_ML_FRONTEND_SAMPLE_RATE_HZ)) {
+  // DCT settings
+  config.dct.enable_dct = SL_ML_FRONTEND_DCT_ENABLE;
+  config.dct.num_coefficients = SL_ML_FRONTEND_DCT_N_COEFFICIENTS;
+
+  // Energy gate settings
+  EnergyGateFillConfigWithDefaults(&config.energy_gate);
+  config.energy_gate.enable_energy_gate = SL_ML_FRONTEND_ENERGY_GATE_ENABLE;
+  config.energy_gate.threshold_ratio = SL_ML_FRONTEND_ENERGY_GATE_THRESHOLD_RATIO;
+  config.energy_gate.min_energy = SL_ML_FRONTEND_ENERGY_GATE_MIN_ENERGY;
+  config.energy_gate.hangover_frames = SL_ML_FRONTEND_ENERGY_GATE_HANGOVER_FRAMES;
+
+#if SL_ML_AUDIO_FEATURE_GENERATION_CONST_TABLES_ENABLE
+  const int populated = FrontendPopulateStateFromTables(&config, &sl_ml_frontend_tables,
+                                                        &frontend_state, SL_ML_FRONTEND_SAMPLE_RATE_HZ);
+#else
+  const int populated = FrontendPopulateState(&config, &frontend_state, SL_ML_FRONTEND_SAMPLE_RATE_HZ);
+#endif
+  if (!populated) {
     return SL_STATUS_FAIL;
   }
 
@@ -160,9 +215,8 @@ sl_status_t sli_ml_audio_feature_generation_audio_buffer_write_chunk(const int16
   }
 
   // TODO: We should signal an overflow here when write index passes the read index
-  for (uint32_t i = 0; i < num_samples; i++) {
-    audio_buffer[audio_buffer_write_index + i] = new_samples[i] * audio_volume_scaler;
-  }
+  // The gain is applied by the frontend, together with the window.
+  memcpy(&audio_buffer[audio_buffer_write_index], new_samples, num_samples * sizeof(*new_samples));
 
   audio_buffer_write_index = (audio_buffer_write_index + num_samples) % AUDIO_BUFFER_SIZE;
   return SL_STATUS_OK;
@@ -190,6 +244,9 @@ sl_status_t sl_ml_audio_feature_generation_update_features()
   }
 
   num_unfetched_slices += num_slices_updated;
+  if (num_slices_since_fill >= 0) {
+    num_slices_since_fill += num_slices_updated;
+  }
 
   // Could return SL_STATUS_NOT_READY if not full
   return SL_STATUS_OK;
@@ -301,6 +358,42 @@ sl_status_t sli_ml_audio_feature_generation_get_features_dynamically_quantized(i
   return SL_STATUS_OK;
 }
 
+#if SL_ML_FRONTEND_DCT_ENABLE
+/***************************************************************************//**
+ * @brief
+ *    Retrieves the cepstral coefficients quantized to int8 with the given
+ *    quantization parameters, and copies them to the provided buffer.
+ *
+ *    The coefficients are converted to the DCT of the natural log of the
+ *    filterbank energies, by removing the log scale shift.
+ ******************************************************************************/
+static sl_status_t get_features_cepstral_quantized(int8_t *buffer,
+                                                   size_t num_elements,
+                                                   float scale,
+                                                   int32_t zero_point)
+{
+  if (num_elements != FEATURE_BUFFER_SIZE) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  if (scale <= 0.0f) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  const float value_scale = 1.0f / ((float)(1 << SL_ML_FRONTEND_LOG_SCALE_SHIFT) * scale);
+  for (int i = 0; i < FEATURE_BUFFER_SIZE; i++) {
+    const int capture_index = (feature_buffer_start + i) % FEATURE_BUFFER_SIZE;
+    const float scaled = (int16_t)feature_buffer[capture_index] * value_scale;
+    int32_t value = (int32_t)(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f) + zero_point;
+    value = SL_MIN(SL_MAX(value, -128), 127);
+    buffer[i] = (int8_t)value;
+  }
+
+  num_unfetched_slices = 0;
+  return SL_STATUS_OK;
+}
+#endif
+
 #if defined(SL_CATALOG_TFLITE_MICRO_PRESENT)
 /***************************************************************************//**
  *  Fills a TensorFlow tensor with feature data
@@ -310,7 +403,15 @@ sl_status_t sl_ml_audio_feature_generation_fill_tensor(TfLiteTensor *input_tenso
   sl_status_t status = SL_STATUS_OK;
   if (input_tensor->type == kTfLiteInt8) {
 
-    #if defined(SL_ML_AUDIO_FEATURE_GENERATION_QUANTIZE_DYNAMIC_SCALE_ENABLE) && (SL_ML_AUDIO_FEATURE_GENERATION_QUANTIZE_DYNAMIC_SCALE_ENABLE == 1)
+    #if SL_ML_FRONTEND_DCT_ENABLE
+      // Cepstral coefficients are signed, they are quantized with the
+      // parameters of the input tensor
+      status = get_features_cepstral_quantized(input_tensor->data.int8,
+                                               input_tensor->bytes,
+                                               input_tensor->params.scale,
+                                               input_tensor->params.zero_point);
+      const int new_slices = num_slices_since_fill;
+    #elif defined(SL_ML_AUDIO_FEATURE_GENERATION_QUANTIZE_DYNAMIC_SCALE_ENABLE) && (SL_ML_AUDIO_FEATURE_GENERATION_QUANTIZE_DYNAMIC_SCALE_ENABLE == 1)
 
       // Set the scale range for dynamic quantization
       // dynamic_range = DYNAMIC_SCALE_RANGE_DB*(2^log_scale_shift)*ln(10)/20
@@ -319,13 +420,25 @@ sl_status_t sl_ml_audio_feature_generation_fill_tensor(TfLiteTensor *input_tenso
       status = sli_ml_audio_feature_generation_get_features_dynamically_quantized(input_tensor->data.int8,
                                                                                   input_tensor->bytes,
                                                                                   dynamic_scale_range);
+
+      // The scale depends on the whole spectrogram, every value may change
+      const int new_slices = -1;
     #else
       status = sli_ml_audio_feature_generation_get_features_quantized(input_tensor->data.int8,
                                                                     input_tensor->bytes,
                                                                     SL_ML_AUDIO_FEATURE_GENERATION_QUANTIZE_FEATURE_RANGE_MIN,
                                                                     SL_ML_AUDIO_FEATURE_GENERATION_QUANTIZE_FEATURE_RANGE_MAX);
+      const int new_slices = num_slices_since_fill;
     #endif
 
+    if (status == SL_STATUS_OK) {
+      // Allow streaming kernels to reuse results for the unchanged slices
+      sl_tflite_micro_streaming_input_update(FEATURE_SLICE_SIZE,
+                                             FEATURE_BUFFER_SLICE_COUNT,
+                                             new_slices);
+      num_slices_since_fill = 0;
+    }
+
   } else {
     status = SL_STATUS_INVALID_PARAMETER;
   }
@@ -361,6 +474,7 @@ void sl_ml_audio_feature_generation_reset()
 
   // Reset slice counter
   num_unfetched_slices = 0;
+  num_slices_since_fill = -1;
 
   FrontendReset(&frontend_state);
 }
@@ -393,27 +507,13 @@ int sl_ml_audio_feature_generation_get_feature_buffer_size()
  ******************************************************************************/
 static sl_status_t process_audio_buffer_chunk(const int16_t *audio_data, size_t *slices_updated)
 {
-  size_t num_samples = AUDIO_BUFFER_CHUNK_SIZE;
-
-  while (num_samples > 0) {
-    size_t num_samples_read;
-    struct FrontendOutput output = FrontendProcessSamples(
-      &frontend_state, audio_data, num_samples, &num_samples_read);
-
-    audio_data += num_samples_read;
-    num_samples -= num_samples_read;
-    if (output.values != NULL) {
-      for (size_t i = 0; i < output.size; i++) {
-        feature_buffer[feature_buffer_start + i] = output.values[i];
-      }
-
-      feature_buffer_start = (feature_buffer_start + output.size) % (FEATURE_BUFFER_SIZE);
-      *slices_updated += 1;
-    } else {
-      // No feature slice was generated, but data is stored internally in the frontend for
-      // next iteration.
-    }
-  }
+  // All the slices of the chunk are written straight into the feature buffer.
+  size_t write_index = feature_buffer_start;
+  const int frames = FrontendProcessSamplesBatch(&frontend_state, audio_data,
+                                                 AUDIO_BUFFER_CHUNK_SIZE, feature_buffer,
+                                                 FEATURE_BUFFER_SIZE, &write_index);
+  feature_buffer_start = write_index;
+  *slices_updated += frames;
 
   return SL_STATUS_OK;
 }
@@ -41,7 +41,10 @@
  ******************************************************************************/
 #define AUDIO_BUFFER_SIZE           (SL_ML_AUDIO_FEATURE_GENERATION_AUDIO_BUFFER_SIZE)
 #define FEATURE_BUFFER_SLICE_COUNT  (1 + ((SL_ML_FRONTEND_SAMPLE_LENGTH_MS - SL_ML_FRONTEND_WINDOW_SIZE_MS) / SL_ML_FRONTEND_WINDOW_STEP_MS))
-#define FEATURE_BUFFER_SIZE         (SL_ML_FRONTEND_FILTERBANK_N_CHANNELS * FEATURE_BUFFER_SLICE_COUNT)
+// With the DCT enabled, a slice holds int16 cepstral coefficients instead of
+// the filterbank channels
+#define FEATURE_SLICE_SIZE          (SL_ML_FRONTEND_DCT_ENABLE ? SL_ML_FRONTEND_DCT_N_COEFFICIENTS : SL_ML_FRONTEND_FILTERBANK_N_CHANNELS)
+#define FEATURE_BUFFER_SIZE         (FEATURE_SLICE_SIZE * FEATURE_BUFFER_SLICE_COUNT)
 
 
 #define max(a,b) \
@@ -95,6 +98,12 @@ extern void dump_float_spectrogram(const float* buffer, int length);
 
 static sl_status_t process_audio_buffer_chunk(const int16_t *audio_data, size_t num_samples, size_t *slices_updated);
 
+// Cepstral coefficients are int16 values stored in the uint16 feature buffer
+static inline float feature_to_float(uint16_t value)
+{
+  return SL_ML_FRONTEND_DCT_ENABLE ? (float)(int16_t)value : (float)value;
+}
+
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -131,6 +140,13 @@ sl_status_t sl_ml_audio_feature_generation_frontend_init()
   // Window settings
   config.window.size_ms = SL_ML_FRONTEND_WINDOW_SIZE_MS;
   config.window.step_size_ms = SL_ML_FRONTEND_WINDOW_STEP_MS;
+#if SL_ML_AUDIO_FEATURE_GENERATION_FUSED_WINDOW_ENABLE
+  // The gain, DC notch filter and window are applied in a single pass
+  config.window.ring_buffer = 1;
+#else
+  config.window.ring_buffer = 0;
+#endif
+  config.window.input_gain = audio_volume_scaler > 1 ? audio_volume_scaler : 1;
 
   // Filterbank settings
   config.filterbank.num_channels = SL_ML_FRONTEND_FILTERBANK_N_CHANNELS;
@@ -168,6 +184,17 @@ sl_status_t sl_ml_audio_feature_generation_frontend_init()
   config.dc_notch_filter.enable_dc_notch_filter = SL_ML_FRONTEND_DC_NOTCH_FILTER_ENABLE;
   config.dc_notch_filter.coefficient = SL_ML_FRONTEND_DC_NOTCH_FILTER_COEFFICIENT;
 
+  // DCT settings
+  config.dct.enable_dct = SL_ML_FRONTEND_DCT_ENABLE;
+  config.dct.num_coefficients = SL_ML_FRONTEND_DCT_N_COEFFICIENTS;
+
+  // Energy gate settings
+  EnergyGateFillConfigWithDefaults(&config.energy_gate);
+  config.energy_gate.enable_energy_gate = SL_ML_FRONTEND_ENERGY_GATE_ENABLE;
+  config.energy_gate.threshold_ratio = SL_ML_FRONTEND_ENERGY_GATE_THRESHOLD_RATIO;
+  config.energy_gate.min_energy = SL_ML_FRONTEND_ENERGY_GATE_MIN_ENERGY;
+  config.energy_gate.hangover_frames = SL_ML_FRONTEND_ENERGY_GATE_HANGOVER_FRAMES;
+
   if(SL_ML_AUDIO_FEATURE_GENERATION_QUANTIZE_DYNAMIC_SCALE_ENABLE)
   {
     // dynamic_range = SL_ML_AUDIO_FEATURE_GENERATION_QUANTIZE_DYNAMIC_SCALE_RANGE_DB*(2^log_scale_shift)*ln(10)/20
@@ -202,13 +229,7 @@ sl_status_t sl_ml_audio_feature_generation_frontend_init()
 sl_status_t sli_ml_audio_feature_generation_audio_buffer_write_chunk(const int16_t *new_samples, size_t num_samples)
 {
   // TODO: We should signal an overflow here when write index passes the read index
-  if(audio_volume_scaler > 1) {
-    int index = audio_buffer_write_index;
-    for (uint32_t i = 0; i < num_samples; i++) {
-      audio_buffer[index] = audio_buffer[index] * audio_volume_scaler;
-      index = (index + 1) % AUDIO_BUFFER_SIZE;
-    }
-  }
+  // The gain is applied by the frontend, together with the window.
 
  /* int index = audio_buffer_write_index;
      for (uint32_t i = 0; i < num_samples; i++) {
@@ -304,7 +325,7 @@ sl_status_t sl_ml_audio_feature_generation_get_features_raw_float32(float *buffe
 
   int read_index = feature_buffer_read_index;
   for (int i = 0; i < FEATURE_BUFFER_SIZE; i++) {
-    buffer[i] = (float)feature_buffer[read_index];
+    buffer[i] = feature_to_float(feature_buffer[read_index]);
     read_index = (read_index + 1) % FEATURE_BUFFER_SIZE;
   }
 
@@ -425,7 +446,7 @@ sl_status_t sl_ml_audio_feature_generation_get_features_scaled(float *buffer, si
 
   int read_index = feature_buffer_read_index;
   for (int i = 0; i < FEATURE_BUFFER_SIZE; i++) {
-    const float value = (float)feature_buffer[read_index];
+    const float value = feature_to_float(feature_buffer[read_index]);
     read_index = (read_index + 1) % FEATURE_BUFFER_SIZE;
     buffer[i] = value * scaler;
   }
@@ -453,7 +474,7 @@ sl_status_t sl_ml_audio_feature_generation_get_features_mean_std_normalized(floa
   // Calculate the STD and mean
   for(int i = FEATURE_BUFFER_SIZE; i > 0; --i)
   {
-    const float value = (float)feature_buffer[read_index];
+    const float value = feature_to_float(feature_buffer[read_index]);
     read_index = (read_index + 1) % FEATURE_BUFFER_SIZE;
 
     count += 1;
@@ -473,7 +494,7 @@ sl_status_t sl_ml_audio_feature_generation_get_features_mean_std_normalized(floa
   float* dst = buffer;
   for(int i = FEATURE_BUFFER_SIZE; i > 0; --i)
   {
-    const float value = (float)feature_buffer[read_index];
+    const float value = feature_to_float(feature_buffer[read_index]);
     read_index = (read_index + 1) % FEATURE_BUFFER_SIZE;
     const float x = value - mean;
 
@@ -486,6 +507,43 @@ sl_status_t sl_ml_audio_feature_generation_get_features_mean_std_normalized(floa
   return SL_STATUS_OK;
 }
 
+/***************************************************************************//**
+ * @brief
+ *    Retrieves the cepstral coefficients quantized to int8 with the given
+ *    quantization parameters, and copies them to the provided buffer.
+ *
+ *    The coefficients are converted to the DCT of the natural log of the
+ *    filterbank energies, by removing the log scale shift.
+ ******************************************************************************/
+static sl_status_t get_features_cepstral_quantized(int8_t *buffer,
+                                                   size_t num_elements,
+                                                   float scale,
+                                                   int32_t zero_point)
+{
+  if ((int)num_elements != FEATURE_BUFFER_SIZE) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  if (scale <= 0.0f) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  const float value_scale = 1.0f / ((float)(1 << SL_ML_FRONTEND_LOG_SCALE_SHIFT) * scale);
+  int read_index = feature_buffer_read_index;
+  for (int i = 0; i < FEATURE_BUFFER_SIZE; i++) {
+    const float scaled = feature_to_float(feature_buffer[read_index]) * value_scale;
+    read_index = (read_index + 1) % FEATURE_BUFFER_SIZE;
+    int32_t value = (int32_t)(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f) + zero_point;
+    value = min(max(value, -128), 127);
+    buffer[i] = (int8_t)value;
+  }
+
+  feature_buffer_read_index = read_index;
+  num_unfetched_slices = 0;
+
+  return SL_STATUS_OK;
+}
+
 /***************************************************************************//**
  *  Fills a TensorFlow tensor with feature data
  ******************************************************************************/
@@ -493,7 +551,16 @@ sl_status_t sl_ml_audio_feature_generation_fill_tensor(TfLiteTensor *input_tenso
 {
   sl_status_t status = SL_STATUS_OK;
   if (input_tensor->type == kTfLiteInt8) {
-    if(SL_ML_AUDIO_FEATURE_GENERATION_QUANTIZE_DYNAMIC_SCALE_ENABLE) {
+    if(SL_ML_FRONTEND_DCT_ENABLE) {
+      // Cepstral coefficients are signed, they are quantized with the
+      // parameters of the input tensor
+      status = get_features_cepstral_quantized(
+        input_tensor->data.int8,
+        input_tensor->bytes,
+        input_tensor->params.scale,
+        input_tensor->params.zero_point
+      );
+    } else if(SL_ML_AUDIO_FEATURE_GENERATION_QUANTIZE_DYNAMIC_SCALE_ENABLE) {
       status = sli_ml_audio_feature_generation_get_features_dynamically_quantized(
         input_tensor->data.int8,
         input_tensor->bytes,
@@ -616,27 +683,12 @@ sl_status_t sl_ml_audio_feature_generation_activity_detected()
  ******************************************************************************/
 static sl_status_t process_audio_buffer_chunk(const int16_t *audio_data, size_t num_samples, size_t *slices_updated)
 {
-  int write_index = feature_buffer_write_index;
-
-  while (num_samples > 0) {
-    size_t num_samples_read;
-    struct FrontendOutput output = FrontendProcessSamples(
-      &frontend_state, audio_data, num_samples, &num_samples_read);
-
-    audio_data += num_samples_read;
-    num_samples -= num_samples_read;
-    if (output.values != NULL) {
-      for (size_t i = 0; i < output.size; i++) {
-        feature_buffer[write_index + i] = output.values[i];
-      }
-
-      write_index = (write_index + output.size) % (FEATURE_BUFFER_SIZE);
-      *slices_updated += 1;
-    } else {
-      // No feature slice was generated, but data is stored internally in the frontend for
-      // next iteration.
-    }
-  }
+  // All the slices of the chunk are written straight into the feature buffer.
+  size_t write_index = feature_buffer_write_index;
+  const int frames = FrontendProcessSamplesBatch(&frontend_state, audio_data, num_samples,
+                                                 feature_buffer, FEATURE_BUFFER_SIZE,
+                                                 &write_index);
+  *slices_updated += frames;
 
   feature_buffer_write_index = write_index;
 
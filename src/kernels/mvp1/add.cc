@@ -15,6 +15,7 @@ limitations under the License.
 
 #include "tensorflow/lite/kernels/internal/reference/add.h"
 
+#include "Include/arm_nnfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
@@ -26,6 +27,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 
 #include "sl_mvp_ml_add.h"
+#include "kernel_backend.h"
 
 namespace tflite {
 namespace sl {
@@ -37,6 +39,7 @@ constexpr int kOutputTensor = 0;
 
 struct OpData {
   bool requires_broadcast;
+  bool use_mvp;
 
   int input1_shift;
   int input2_shift;
@@ -99,10 +102,16 @@ TfLiteStatus CalculateOpData(TfLiteContext* context, TfLiteAddParams* params,
     QuantizeMultiplierSmallerThanOneExp(
         real_output_multiplier, &data->output_multiplier, &data->output_shift);
 
+    data->use_mvp = kernel_backend::MvpEnabled();
+    kernel_backend::Report(data->requires_broadcast ? kernel_backend::kReference
+                           : data->use_mvp          ? kernel_backend::kMvp
+                           : kernel_backend::kCmsisNN);
+
   } else if (output->type == kTfLiteFloat32) {
     CalculateActivationRange(params->activation,
                              &data->output_activation_min_f32,
                              &data->output_activation_max_f32);
+    kernel_backend::Report(kernel_backend::kReference);
   }
 
   return kTfLiteOk;
@@ -154,7 +163,7 @@ TfLiteStatus EvalAddQuantized(TfLiteContext* context, TfLiteNode* node,
                                               tflite::micro::GetTensorShape(input1), tflite::micro::GetTensorData<int8_t>(input1),
                                               tflite::micro::GetTensorShape(input2), tflite::micro::GetTensorData<int8_t>(input2),
                                               tflite::micro::GetTensorShape(output), tflite::micro::GetTensorData<int8_t>(output));
-  } else {
+  } else if (data->use_mvp) {
     sli_mvp_ml_add_s8_params_t params = data->params;
     params.input1 = tflite::micro::GetTensorData<int8_t>(input1);
     params.input2 = tflite::micro::GetTensorData<int8_t>(input2);
@@ -163,6 +172,19 @@ TfLiteStatus EvalAddQuantized(TfLiteContext* context, TfLiteNode* node,
     if (ret != SL_STATUS_OK) {
         status = kTfLiteError;
     }
+  } else {
+    arm_elementwise_add_s8(tflite::micro::GetTensorData<int8_t>(input1),
+                           tflite::micro::GetTensorData<int8_t>(input2),
+                           op_params.input1_offset, op_params.input1_multiplier,
+                           op_params.input1_shift, op_params.input2_offset,
+                           op_params.input2_multiplier, op_params.input2_shift,
+                           op_params.left_shift,
+                           tflite::micro::GetTensorData<int8_t>(output),
+                           op_params.output_offset, op_params.output_multiplier,
+                           op_params.output_shift,
+                           op_params.quantized_activation_min,
+                           op_params.quantized_activation_max,
+                           static_cast<int32_t>(data->params.length));
   }
 
   return status;
@@ -0,0 +1,253 @@
+
+#include "compressed_weights.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace tflite {
+namespace sl {
+namespace compressed_weights {
+
+static TfLiteIntArray* allocate_dims(TfLiteContext* context, int size)
+{
+  TfLiteIntArray *dims = static_cast<TfLiteIntArray*>(
+    context->AllocatePersistentBuffer(context, sizeof(TfLiteIntArray) + size * sizeof(int)));
+  if (dims != nullptr) {
+    dims->size = size;
+  }
+  return dims;
+}
+
+static TfLiteStatus prepare_block_sparse(TfLiteContext* context,
+                                         const TfLiteTensor* tensor,
+                                         Weights* weights)
+{
+  const uint8_t *buffer = tensor->data.uint8;
+
+  // The tensor holds the buffer, its size is the size of the buffer.
+  TF_LITE_ENSURE_EQ(context, NumDimensions(tensor), 1);
+
+  BlockSparseHeader header;
+  TF_LITE_ENSURE(context, tensor->bytes >= sizeof(header));
+  memcpy(&header, buffer, sizeof(header));
+  TF_LITE_ENSURE(context, header.block_rows > 0 && header.block_cols > 0);
+  TF_LITE_ENSURE(context, header.units > 0 && header.depth > 0);
+  TF_LITE_ENSURE(context, static_cast<int64_t>(header.units) * header.depth <= INT32_MAX);
+
+  const int units = header.units;
+  const int depth = header.depth;
+  TfLiteIntArray *dims = allocate_dims(context, 2);
+  TF_LITE_ENSURE(context, dims != nullptr);
+  dims->data[0] = units;
+  dims->data[1] = depth;
+  TF_LITE_ENSURE(context, units % header.block_rows == 0);
+  TF_LITE_ENSURE(context, depth % header.block_cols == 0);
+
+  // The buffer must hold both index arrays and the weights of every
+  // nonzero block.
+  const int row_blocks = units / header.block_rows;
+  const int col_blocks = depth / header.block_cols;
+  const size_t nonzero_blocks = header.nonzero_blocks;
+  TF_LITE_ENSURE(context, nonzero_blocks <= static_cast<size_t>(row_blocks) * col_blocks);
+  const size_t index_bytes = (row_blocks + 1 + nonzero_blocks) * sizeof(uint16_t);
+  const size_t block_bytes = nonzero_blocks * header.block_rows * header.block_cols;
+  TF_LITE_ENSURE(context, tensor->bytes >= sizeof(header) + index_bytes + block_bytes);
+
+  weights->format      = kWeightsBlockSparse;
+  weights->dims        = dims;
+  weights->block_rows  = header.block_rows;
+  weights->block_cols  = header.block_cols;
+  weights->block_ptr   = reinterpret_cast<const uint16_t*>(buffer + sizeof(header));
+  weights->block_index = weights->block_ptr + row_blocks + 1;
+  weights->data        = reinterpret_cast<const int8_t*>(weights->block_index + nonzero_blocks);
+
+  TF_LITE_ENSURE(context, weights->block_ptr[0] == 0);
+  TF_LITE_ENSURE(context, weights->block_ptr[row_blocks] == nonzero_blocks);
+  for (int r = 0; r < row_blocks; r++) {
+    TF_LITE_ENSURE(context, weights->block_ptr[r] <= weights->block_ptr[r + 1]);
+  }
+  for (size_t i = 0; i < nonzero_blocks; i++) {
+    TF_LITE_ENSURE(context, weights->block_index[i] < col_blocks);
+  }
+  return kTfLiteOk;
+}
+
+static TfLiteStatus prepare_codebook(TfLiteContext* context,
+                                     const TfLiteTensor* tensor,
+                                     Weights* weights)
+{
+  const uint8_t *buffer = tensor->data.uint8;
+
+  // The tensor holds the buffer, its size is the size of the buffer.
+  TF_LITE_ENSURE_EQ(context, NumDimensions(tensor), 1);
+
+  CodebookHeader header;
+  TF_LITE_ENSURE(context, tensor->bytes >= sizeof(header));
+  memcpy(&header, buffer, sizeof(header));
+  TF_LITE_ENSURE(context, header.index_bits >= 1 && header.index_bits <= 8);
+  const int table_size = 1 << header.index_bits;
+  TF_LITE_ENSURE(context, header.codebook_size >= 1
+                 && header.codebook_size <= table_size);
+  TF_LITE_ENSURE(context, header.dims_count >= 1 && header.dims_count <= kMaxWeightDims);
+
+  TfLiteIntArray *dims = allocate_dims(context, header.dims_count);
+  TF_LITE_ENSURE(context, dims != nullptr);
+  int64_t elements = 1;
+  for (int i = 0; i < header.dims_count; i++) {
+    TF_LITE_ENSURE(context, header.dims[i] > 0);
+    dims->data[i] = header.dims[i];
+    elements *= header.dims[i];
+    TF_LITE_ENSURE(context, elements <= INT32_MAX);
+  }
+
+  const size_t index_bytes = (static_cast<size_t>(elements) * header.index_bits + 7) / 8;
+  TF_LITE_ENSURE(context, tensor->bytes >= sizeof(header) + header.codebook_size + index_bytes);
+
+  // Every index value must decode to a defined weight. The codebook is
+  // copied into a table with one entry per index value, the unused entries
+  // decode to zero.
+  int8_t *codebook = static_cast<int8_t*>(
+    context->AllocatePersistentBuffer(context, table_size));
+  TF_LITE_ENSURE(context, codebook != nullptr);
+  memset(codebook, 0, table_size);
+  memcpy(codebook, buffer + sizeof(header), header.codebook_size);
+
+  weights->format     = kWeightsCodebook;
+  weights->dims       = dims;
+  weights->codebook   = codebook;
+  weights->data       = reinterpret_cast<const int8_t*>(buffer + sizeof(header) + header.codebook_size);
+  weights->index_bits = header.index_bits;
+  return kTfLiteOk;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, const TfLiteTensor* tensor,
+                     Weights* weights)
+{
+  weights->dims       = tensor->dims;
+  weights->data       = tensor->data.int8;
+  weights->codebook   = nullptr;
+  weights->index_bits = 8;
+  weights->block_ptr   = nullptr;
+  weights->block_index = nullptr;
+  weights->block_rows  = 0;
+  weights->block_cols  = 0;
+
+  switch (tensor->type) {
+    case kTfLiteInt8:
+      weights->format = kWeightsInt8;
+      return kTfLiteOk;
+    case kTfLiteInt4:
+      weights->format = kWeightsInt4;
+      weights->index_bits = 4;
+      return kTfLiteOk;
+    case kTfLiteUInt8:
+      TF_LITE_ENSURE(context, tensor->data.uint8 != nullptr);
+      TF_LITE_ENSURE(context, tensor->bytes >= sizeof(kCodebookMagic));
+      if (memcmp(tensor->data.uint8, kCodebookMagic, sizeof(kCodebookMagic)) == 0) {
+        return prepare_codebook(context, tensor, weights);
+      }
+      if (memcmp(tensor->data.uint8, kBlockSparseMagic, sizeof(kBlockSparseMagic)) == 0) {
+        return prepare_block_sparse(context, tensor, weights);
+      }
+      MicroPrintf("Weights of type uint8 must be palettized or block sparse.");
+      return kTfLiteError;
+    default:
+      MicroPrintf("Weights of type %s not supported.", TfLiteTypeGetName(tensor->type));
+      return kTfLiteError;
+  }
+}
+
+// Two signed 4-bit values per byte, the lower nibble holds the element with
+// the lower index.
+static void unpack_int4(const int8_t* src, int offset, int count, int8_t* dst)
+{
+  const int8_t* packed = src + offset / 2;
+
+  if (count > 0 && (offset & 1)) {
+    *dst++ = static_cast<int8_t>(*packed++ >> 4);
+    count--;
+  }
+  for (; count >= 2; count -= 2) {
+    const int8_t value = *packed++;
+    *dst++ = static_cast<int8_t>(static_cast<int8_t>(static_cast<uint8_t>(value) << 4) >> 4);
+    *dst++ = static_cast<int8_t>(value >> 4);
+  }
+  if (count > 0) {
+    *dst = static_cast<int8_t>(static_cast<int8_t>(static_cast<uint8_t>(*packed) << 4) >> 4);
+  }
+}
+
+static void unpack_codebook(const Weights& weights, int offset, int count, int8_t* dst)
+{
+  const uint8_t *packed = reinterpret_cast<const uint8_t*>(weights.data);
+  const int8_t *codebook = weights.codebook;
+  const int bits = weights.index_bits;
+
+  if (bits == 8) {
+    packed += offset;
+    for (int i = 0; i < count; i++) {
+      dst[i] = codebook[packed[i]];
+    }
+    return;
+  }
+
+  if (bits == 4 && !(offset & 1)) {
+    packed += offset / 2;
+    for (; count >= 2; count -= 2) {
+      const uint8_t value = *packed++;
+      *dst++ = codebook[value & 0x0F];
+      *dst++ = codebook[value >> 4];
+    }
+    if (count > 0) {
+      *dst = codebook[*packed & 0x0F];
+    }
+    return;
+  }
+
+  if (count <= 0) {
+    return;
+  }
+
+  // Generic bit stream, refilled a byte at a time.
+  const uint32_t mask = (1U << bits) - 1U;
+  const uint32_t first_bit = static_cast<uint32_t>(offset) * bits;
+  packed += first_bit / 8;
+  uint32_t acc = *packed++ >> (first_bit % 8);
+  int acc_bits = 8 - static_cast<int>(first_bit % 8);
+
+  for (int i = 0; i < count; i++) {
+    if (acc_bits < bits) {
+      acc |= static_cast<uint32_t>(*packed++) << acc_bits;
+      acc_bits += 8;
+    }
+    dst[i] = codebook[acc & mask];
+    acc >>= bits;
+    acc_bits -= bits;
+  }
+}
+
+void Decompress(const Weights& weights, int offset, int count, int8_t* dst)
+{
+  switch (weights.format) {
+    case kWeightsInt4:
+      unpack_int4(weights.data, offset, count, dst);
+      break;
+    case kWeightsCodebook:
+      unpack_codebook(weights, offset, count, dst);
+      break;
+    case kWeightsBlockSparse:
+      // Rejected when the kernel is prepared
+      break;
+    case kWeightsInt8:
+    default:
+      memcpy(dst, weights.data + offset, count);
+      break;
+  }
+}
+
+}  // namespace compressed_weights
+}  // namespace sl
+}  // namespace tflite
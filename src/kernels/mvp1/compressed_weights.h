@@ -0,0 +1,96 @@
+
+#ifndef SL_MVP1_COMPRESSED_WEIGHTS_H
+#define SL_MVP1_COMPRESSED_WEIGHTS_H
+
+#include "tensorflow/lite/c/common.h"
+
+#include "sl_tflite_micro_config.h"
+
+// Upper bound in bytes of the scratch buffer holding one tile of unpacked
+// fully connected weights or convolution filters.
+#ifndef SL_TFLITE_MICRO_WEIGHT_TILE_SIZE
+#define SL_TFLITE_MICRO_WEIGHT_TILE_SIZE (4096)
+#endif
+
+namespace tflite {
+namespace sl {
+namespace compressed_weights {
+
+enum weight_format { kWeightsInt8, kWeightsInt4, kWeightsCodebook, kWeightsBlockSparse };
+
+// Maximum number of dimensions of compressed weights.
+constexpr int kMaxWeightDims = 4;
+
+// Palettized weights are stored in a one dimensional kTfLiteUInt8 tensor
+// holding the buffer, so that the tensor size is the size of the buffer. The
+// buffer starts with this header, holding the logical shape of the weights,
+// followed by codebook_size int8 values and the codebook indices packed LSB
+// first with index_bits bits per weight.
+struct CodebookHeader {
+  uint8_t  magic[4];
+  uint8_t  index_bits;
+  uint8_t  dims_count;
+  uint16_t codebook_size;
+  int32_t  dims[kMaxWeightDims];
+};
+
+constexpr uint8_t kCodebookMagic[4] = { 'S', 'L', 'C', 'B' };
+
+// Block sparse fully connected weights are stored in a one dimensional
+// kTfLiteUInt8 tensor holding the buffer, like palettized weights. The
+// [units, depth] weights are split in blocks of block_rows x block_cols, only
+// the nonzero blocks are stored. The buffer starts with this header, followed
+// by
+//  - uint16_t block_ptr[units / block_rows + 1], the index of the first
+//    nonzero block of every row of blocks,
+//  - uint16_t block_index[nonzero_blocks], the column of every nonzero block
+//    in units of block_cols,
+//  - the int8 weights of every row of blocks, stored as a dense
+//    [block_rows, nonzero blocks in the row * block_cols] matrix.
+struct BlockSparseHeader {
+  uint8_t  magic[4];
+  uint8_t  block_rows;
+  uint8_t  block_cols;
+  uint16_t reserved;
+  uint32_t nonzero_blocks;
+  int32_t  units;
+  int32_t  depth;
+};
+
+constexpr uint8_t kBlockSparseMagic[4] = { 'S', 'L', 'B', 'S' };
+
+struct Weights {
+  weight_format format;
+  // Logical shape of the weights. For palettized and block sparse weights it
+  // is read from the header, otherwise it is the shape of the tensor.
+  TfLiteIntArray *dims;
+  const int8_t  *data;
+  const int8_t  *codebook;
+  int           index_bits;
+
+  // Block sparse layout
+  const uint16_t *block_ptr;
+  const uint16_t *block_index;
+  int           block_rows;
+  int           block_cols;
+};
+
+// Determine the storage format of a constant weight tensor. Returns
+// kTfLiteError for tensors which cannot be used as int8 weights.
+TfLiteStatus Prepare(TfLiteContext* context, const TfLiteTensor* tensor,
+                     Weights* weights);
+
+inline bool IsCompressed(const Weights& weights)
+{
+  return weights.format != kWeightsInt8;
+}
+
+// Unpack count weights starting at element offset into dst as int8 values.
+// Block sparse weights cannot be unpacked, they are used as is by the kernel.
+void Decompress(const Weights& weights, int offset, int count, int8_t* dst);
+
+}  // namespace compressed_weights
+}  // namespace sl
+}  // namespace tflite
+
+#endif  // SL_MVP1_COMPRESSED_WEIGHTS_H
@@ -5,8 +5,13 @@
 #include "tensorflow/lite/kernels/padding.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "Include/arm_nnfunctions.h"
+#include "Include/arm_nnsupportfunctions.h"
 
 #include "sl_mvp_ml_conv2d.h"
+#include "sl_mvp_ml_fully_connected.h"
+#include "streaming_conv.h"
+#include "compressed_weights.h"
+#include "kernel_backend.h"
 
 namespace tflite {
 namespace sl {
@@ -21,7 +26,7 @@ constexpr int kOutputTensor = 0;
 // https://www.tensorflow.org/lite/performance/quantization_spec
 constexpr int kConvQuantizedDimension = 0;
 
-enum op_support { kMvp, kCmsisNN, kTFLMrefF32 };
+enum op_support { kMvp, kMvpPointwise, kCmsisNN, kCmsisNNPointwise, kTFLMrefF32 };
 
 struct OpData {
   op_support  supported;
@@ -33,6 +38,22 @@ struct OpData {
   // CMSIS-NN per channel output multiplier and shift.
   int32_t     *per_channel_output_multiplier;
   int32_t     *per_channel_output_shift;
+
+  // Output row cache used when running on a sliding window input.
+  streaming_conv::State streaming;
+
+  // Compressed filters are unpacked to int8 into an arena scratch buffer,
+  // filter_tile_channels output channels at a time, right before the tile is
+  // computed. When a tile does not cover all output channels, its outputs are
+  // written to output_scratch_index and copied to the output.
+  compressed_weights::Weights filter_weights;
+  int         filter_tile_channels;
+  int         filter_scratch_index;
+  int         output_scratch_index;
+
+  // Pointwise convolutions on the MVP are run as a fully connected layer
+  // with one batch per input pixel.
+  sli_mvp_ml_fully_connected_s8_params_t pointwise_params;
 };
 
 inline float16_t normalize_fp16(float f)
@@ -53,6 +74,160 @@ inline PaddingType RuntimePaddingType(TfLitePadding padding)
   }
 }
 
+// A 1x1 filter with unit stride and no padding reads every input pixel once,
+// the input is used as a [pixels, in_channels] matrix without im2col.
+bool IsPointwise(const sli_mvp_ml_conv2d_s8_params_t& params)
+{
+  return params.filter_height == 1 && params.filter_width == 1
+         && params.stride_height == 1 && params.stride_width == 1
+         && params.pad_height == 0 && params.pad_width == 0
+         && params.input_height == params.output_height
+         && params.input_width == params.output_width;
+}
+
+kernel_backend::backend SelectedBackend(op_support supported)
+{
+  switch (supported) {
+    case kMvp:
+      return kernel_backend::kMvp;
+    case kMvpPointwise:
+      return kernel_backend::kMvpPointwise;
+    case kCmsisNN:
+      return kernel_backend::kCmsisNN;
+    case kCmsisNNPointwise:
+      return kernel_backend::kCmsisNNPointwise;
+    case kTFLMrefF32:
+    default:
+      return kernel_backend::kReference;
+  }
+}
+
+// The MVP matrix multiplication applies a single output multiplier, so only
+// filters with the same scale for every output channel are supported. The
+// pixels are processed in chunks of at most SLI_MVP_MAX_DIM_SIZE rows.
+TfLiteStatus PrepareMvpPointwise(TfLiteContext* context,
+                                 OpData* data,
+                                 const TfLiteTensor* input,
+                                 const TfLiteTensor* filter,
+                                 const TfLiteTensor* bias,
+                                 TfLiteTensor* output,
+                                 const TfLiteFusedActivation& activation,
+                                 bool* supported)
+{
+  *supported = false;
+
+  auto affine_quantization =
+        reinterpret_cast<const TfLiteAffineQuantization*>(filter->quantization.params);
+  const float* filter_scales = affine_quantization->scale->data;
+  for (int i = 1; i < affine_quantization->scale->size; i++) {
+    if (filter_scales[i] != filter_scales[0]) {
+      return kTfLiteOk;
+    }
+  }
+
+  const int num_channels = data->op_params.out_channels;
+  const int pixels = data->op_params.batches * data->op_params.input_height
+                     * data->op_params.input_width;
+  const uint32_t chunk = static_cast<uint32_t>(std::min(pixels, SLI_MVP_MAX_DIM_SIZE));
+
+  int32_t activation_min, activation_max;
+  TF_LITE_ENSURE_STATUS(CalculateActivationRangeQuantized(
+          context, activation, output, &activation_min, &activation_max));
+
+  sli_mvp_ml_fully_connected_s8_params_t& params = data->pointwise_params;
+  params.input             = nullptr;
+  params.input_shape       = {{ chunk, static_cast<uint32_t>(data->op_params.in_channels), 0, 0 }};
+  params.input_offset      = data->op_params.input_offset;
+  params.weight            = nullptr;
+  params.weight_shape      = {{ static_cast<uint32_t>(num_channels),
+                                static_cast<uint32_t>(data->op_params.in_channels), 0, 0 }};
+  params.weight_offset     = 0;
+  params.bias              = nullptr;
+  params.bias_length       = 0;
+  params.output            = nullptr;
+  params.output_shape      = {{ chunk, static_cast<uint32_t>(num_channels), 0, 0 }};
+  params.output_offset     = data->op_params.output_offset;
+  params.output_multiplier = sli_mvp_ml_fully_connected_output_multiplier(
+                               static_cast<double>(input->params.scale) * filter_scales[0]
+                               / output->params.scale);
+  params.activation_min    = static_cast<int8_t>(activation_min);
+  params.activation_max    = static_cast<int8_t>(activation_max);
+
+  if (!sli_mvp_ml_fully_connected_s8_is_supported(&params)) {
+    return kTfLiteOk;
+  }
+
+  if (bias != nullptr) {
+    float16_t *bias_data = static_cast<float16_t*>(context->AllocatePersistentBuffer(
+                           context, num_channels * sizeof(float16_t)));
+    TF_LITE_ENSURE(context, bias_data != nullptr);
+    TF_LITE_ENSURE_EQ(context, SL_STATUS_OK,
+                      sli_mvp_ml_fully_connected_bias_convert(bias->data.i32, bias_data, num_channels));
+    params.bias        = bias_data;
+    params.bias_length = num_channels;
+  }
+
+  *supported = true;
+  return kTfLiteOk;
+}
+
+// Whether the selected MVP kernel accepts a tile of channels output channels.
+bool TileSupported(const OpData* data, int channels)
+{
+  if (data->supported == kMvp) {
+    sli_mvp_ml_conv2d_s8_params_t params = data->op_params;
+    params.out_channels = channels;
+    return sli_mvp_ml_conv2d_s8_is_supported(&params);
+  }
+  if (data->supported == kMvpPointwise) {
+    sli_mvp_ml_fully_connected_s8_params_t params = data->pointwise_params;
+    params.weight_shape.dim[0] = static_cast<uint32_t>(channels);
+    params.bias_length = params.bias != nullptr ? channels : 0;
+    params.output_shape.dim[1] = static_cast<uint32_t>(channels);
+    return sli_mvp_ml_fully_connected_s8_is_supported(&params);
+  }
+  return true;
+}
+
+// Compressed filters are unpacked in tiles of at most
+// SL_TFLITE_MICRO_WEIGHT_TILE_SIZE bytes. The CMSIS-NN pointwise path writes
+// the outputs of a tile in place. The other paths need an output scratch buffer
+// for the tile, and only tile the filter when both buffers together are
+// smaller than the unpacked filter.
+TfLiteStatus PrepareFilterTiles(TfLiteContext* context, OpData* data)
+{
+  const int out_channels = data->op_params.out_channels;
+  const int channel_size = data->op_params.filter_height * data->op_params.filter_width
+                           * data->op_params.in_channels;
+
+  int tile_channels = std::max(1, std::min(out_channels,
+                                           SL_TFLITE_MICRO_WEIGHT_TILE_SIZE / channel_size));
+  int output_scratch_size = 0;
+  if (tile_channels < out_channels && data->supported != kCmsisNNPointwise) {
+    const int pixels = data->supported == kMvpPointwise
+                       ? static_cast<int>(data->pointwise_params.input_shape.dim[0])
+                       : data->op_params.batches * data->op_params.output_height
+                         * data->op_params.output_width;
+    output_scratch_size = pixels * tile_channels;
+    if (tile_channels * channel_size + output_scratch_size >= out_channels * channel_size
+        || !TileSupported(data, tile_channels)) {
+      tile_channels = out_channels;
+      output_scratch_size = 0;
+    }
+  }
+
+  data->filter_tile_channels = tile_channels;
+  TF_LITE_ENSURE_STATUS(
+    context->RequestScratchBufferInArena(
+               context, tile_channels * channel_size, &data->filter_scratch_index));
+  if (output_scratch_size > 0) {
+    TF_LITE_ENSURE_STATUS(
+      context->RequestScratchBufferInArena(
+                 context, output_scratch_size, &data->output_scratch_index));
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus PopulateConvolutionQuantizationParams(
     TfLiteContext* context,
     const TfLiteTensor* input,
@@ -119,15 +294,27 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
   TF_LITE_ENSURE(context, output != nullptr);
   TF_LITE_ENSURE(context, filter != nullptr);
 
+  // The shape of palettized filters is read from their header.
+  data->filter_weights.format = compressed_weights::kWeightsInt8;
+  data->filter_weights.dims = filter->dims;
+  data->filter_scratch_index = -1;
+  data->output_scratch_index = -1;
+  if (input->type == kTfLiteInt8) {
+    TF_LITE_ENSURE_STATUS(compressed_weights::Prepare(context, filter, &data->filter_weights));
+    TF_LITE_ENSURE(context, data->filter_weights.format != compressed_weights::kWeightsBlockSparse);
+  }
+  const TfLiteIntArray* filter_dims = data->filter_weights.dims;
+  TF_LITE_ENSURE_EQ(context, filter_dims->size, 4);
+
   data->op_params.batches         = input->dims->data[0];
   data->op_params.in_channels     = input->dims->data[3];
   data->op_params.input_height    = input->dims->data[1];
   data->op_params.input_width     = input->dims->data[2];
-  data->op_params.out_channels    = filter->dims->data[kConvQuantizedDimension];
+  data->op_params.out_channels    = filter_dims->data[kConvQuantizedDimension];
   data->op_params.output_height   = output->dims->data[1];
   data->op_params.output_width    = output->dims->data[2];
-  data->op_params.filter_height   = filter->dims->data[1];
-  data->op_params.filter_width    = filter->dims->data[2];
+  data->op_params.filter_height   = filter_dims->data[1];
+  data->op_params.filter_width    = filter_dims->data[2];
   data->op_params.input_offset    = -input->params.zero_point;
   data->op_params.output_offset   = output->params.zero_point;
   data->op_params.stride_height   = params->stride_height;
@@ -149,9 +336,24 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
   data->op_params.pad_width  = padding.width;
 
   const int num_channels = data->op_params.out_channels;
+  data->filter_tile_channels = num_channels;
 
   if (input->type == kTfLiteInt8) {
-    if (sli_mvp_ml_conv2d_s8_is_supported(&data->op_params)) {
+    if (compressed_weights::IsCompressed(data->filter_weights)) {
+      TF_LITE_ENSURE_EQ(context, filter_dims->data[3], data->op_params.in_channels);
+    }
+
+    bool mvp_pointwise = false;
+    if (kernel_backend::MvpEnabled() && IsPointwise(data->op_params)) {
+      TF_LITE_ENSURE_STATUS(PrepareMvpPointwise(
+        context, data, input, filter, bias, output, params->activation, &mvp_pointwise));
+    }
+
+    if (mvp_pointwise) {
+      data->supported = kMvpPointwise;
+
+    } else if (kernel_backend::MvpEnabled()
+               && sli_mvp_ml_conv2d_s8_is_supported(&data->op_params)) {
       data->supported = kMvp;
 
       float16_t *bias_data = static_cast<float16_t*>(context->AllocatePersistentBuffer(
@@ -185,10 +387,16 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
       data->per_channel_output_shift = static_cast<int32_t*>(context->AllocatePersistentBuffer(
                                        context, num_channels * sizeof(int32_t)));
 
+      // Palettized filters are stored as a uint8 buffer, the quantization
+      // parameters and the shape are those of the decompressed int8 filter.
+      TfLiteTensor filter_int8 = *filter;
+      filter_int8.type = kTfLiteInt8;
+      filter_int8.dims = data->filter_weights.dims;
+
       int32_t dummy_output_multiplier;
       int dummy_output_shift;
       TF_LITE_ENSURE_STATUS(tflite::PopulateConvolutionQuantizationParams(
-        context, input, filter, bias, output, params->activation,
+        context, input, &filter_int8, bias, output, params->activation,
         &dummy_output_multiplier, &dummy_output_shift,
         reinterpret_cast<int32_t*>(&data->op_params.output_activation_min),
         reinterpret_cast<int32_t*>(&data->op_params.output_activation_max),
@@ -225,8 +433,23 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
 
       scratch_buffer_size = arm_convolve_wrapper_s8_get_buffer_size(
                             &conv_params, &input_dims, &filter_dims, &output_dims);
+
+      if (IsPointwise(data->op_params)) {
+        // The matrix multiplication reads the input in place.
+        data->supported = kCmsisNNPointwise;
+        scratch_buffer_size = 0;
+      }
     }
 
+    if (compressed_weights::IsCompressed(data->filter_weights)) {
+      TF_LITE_ENSURE_STATUS(PrepareFilterTiles(context, data));
+    }
+
+    TF_LITE_ENSURE_STATUS(streaming_conv::Prepare(
+      context, &data->streaming, node->inputs->data[kInputTensor], input, output,
+      data->op_params.stride_height, data->op_params.dilation_height,
+      data->op_params.filter_height, data->op_params.pad_height));
+
   } else if (input->type == kTfLiteFloat32) {
     data->supported = kTFLMrefF32;
     CalculateActivationRange(params->activation,
@@ -239,6 +462,8 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
     return kTfLiteError;
   }
 
+  kernel_backend::Report(SelectedBackend(data->supported));
+
   if(scratch_buffer_size > 0) {
     TF_LITE_ENSURE_STATUS(
       context->RequestScratchBufferInArena(
@@ -257,34 +482,170 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
   return kTfLiteOk;
 }
 
+// Outputs of a tile of channels output channels, the output itself when the
+// tile covers all output channels, the output scratch buffer otherwise.
+int8_t* tile_output(TfLiteContext* context, const OpData* data, int8_t* output, int channels)
+{
+  if (channels == data->op_params.out_channels) {
+    return output;
+  }
+  return static_cast<int8_t*>(context->GetScratchBuffer(context, data->output_scratch_index));
+}
+
+// Copy the outputs of the channels [channel, channel + channels) of pixels
+// output pixels from the output scratch buffer to the output.
+void scatter_tile(const OpData* data, const int8_t* tile, int8_t* output,
+                  int pixels, int channel, int channels)
+{
+  const int out_channels = data->op_params.out_channels;
+  if (channels == out_channels) {
+    return;
+  }
+  for (int i = 0; i < pixels; i++) {
+    memcpy(output + i * out_channels + channel, tile + i * channels, channels);
+  }
+}
+
 TfLiteStatus eval_mvp_int8(TfLiteContext* context,
                            OpData* data,
                            const TfLiteEvalTensor* input,
-                           const TfLiteEvalTensor* filter,
-                           TfLiteEvalTensor* output)
+                           const int8_t* filter_data,
+                           TfLiteEvalTensor* output,
+                           int row_begin, int row_end,
+                           int channel, int channels)
 {
   data->op_params.input  = tflite::micro::GetTensorData<int8_t>(input);
   data->op_params.output = tflite::micro::GetTensorData<int8_t>(output);
-  data->op_params.filter = tflite::micro::GetTensorData<int8_t>(filter);
+  data->op_params.filter = filter_data;
 
   // Add scratch buffer pointer to op_params
   if (data->scratch_buffer_index > -1){
     data->op_params.scratch_buffer = (float16_t*)context->GetScratchBuffer(context, data->scratch_buffer_index);
   }
 
-  sl_status_t status = sli_mvp_ml_conv2d_s8(&data->op_params);
+  sli_mvp_ml_conv2d_s8_params_t params = data->op_params;
+  if (row_begin > 0 || row_end < params.output_height) {
+    // Only compute a band of output rows
+    const streaming_conv::RowBand band = streaming_conv::Band(&data->streaming, row_begin, row_end);
+    params.input         += band.input_row * data->streaming.input_row_size;
+    params.input_height   = band.input_rows;
+    params.pad_height     = band.pad_top;
+    params.output        += band.output_row * data->streaming.output_row_size;
+    params.output_height  = band.output_rows;
+  }
+
+  int8_t *output_data = params.output;
+  params.out_channels   = channels;
+  params.bias           = params.bias != nullptr ? params.bias + channel : nullptr;
+  params.output_scaler += channel;
+  params.output         = tile_output(context, data, output_data, channels);
+  TF_LITE_ENSURE(context, params.output != nullptr);
+
+  sl_status_t status = sli_mvp_ml_conv2d_s8(&params);
   TF_LITE_ENSURE_EQ(context, SL_STATUS_OK, status);
 
+  scatter_tile(data, params.output, output_data,
+               params.batches * params.output_height * params.output_width, channel, channels);
   return status == SL_STATUS_OK ? kTfLiteOk : kTfLiteError;
 }
 
+// Range of input pixels, and output pixels, of the output rows
+// [row_begin, row_end). Streaming is limited to a single batch, the full
+// range covers all batches.
+void pointwise_pixels(const OpData* data, int row_begin, int row_end,
+                      int* pixel_begin, int* pixel_end)
+{
+  *pixel_begin = row_begin * data->op_params.input_width;
+  *pixel_end   = row_end * data->op_params.input_width;
+  if (row_begin == 0 && row_end == data->op_params.output_height) {
+    *pixel_end *= data->op_params.batches;
+  }
+}
+
+TfLiteStatus eval_mvp_pointwise(TfLiteContext* context,
+                                OpData* data,
+                                const TfLiteEvalTensor* input,
+                                const int8_t* filter_data,
+                                TfLiteEvalTensor* output,
+                                int row_begin, int row_end,
+                                int channel, int channels)
+{
+  const int8_t *input_data = tflite::micro::GetTensorData<int8_t>(input);
+  int8_t *output_data      = tflite::micro::GetTensorData<int8_t>(output) + channel;
+
+  int pixel_begin, pixel_end;
+  pointwise_pixels(data, row_begin, row_end, &pixel_begin, &pixel_end);
+
+  sli_mvp_ml_fully_connected_s8_params_t params = data->pointwise_params;
+  params.weight              = filter_data;
+  params.weight_shape.dim[0] = static_cast<uint32_t>(channels);
+  params.bias                = params.bias != nullptr ? params.bias + channel : nullptr;
+  params.bias_length         = params.bias != nullptr ? channels : 0;
+  params.output_shape.dim[1] = static_cast<uint32_t>(channels);
+
+  for (int pixel = pixel_begin; pixel < pixel_end; pixel += SLI_MVP_MAX_DIM_SIZE) {
+    const uint32_t pixels = static_cast<uint32_t>(std::min(pixel_end - pixel, SLI_MVP_MAX_DIM_SIZE));
+    int8_t *out = output_data + pixel * data->op_params.out_channels;
+    params.input               = input_data + pixel * data->op_params.in_channels;
+    params.input_shape.dim[0]  = pixels;
+    params.output              = tile_output(context, data, out, channels);
+    params.output_shape.dim[0] = pixels;
+    TF_LITE_ENSURE(context, params.output != nullptr);
+
+    sl_status_t status = sli_mvp_ml_fully_connected_s8(&params);
+    TF_LITE_ENSURE_EQ(context, SL_STATUS_OK, status);
+    scatter_tile(data, params.output, out, static_cast<int>(pixels), channel, channels);
+  }
+
+  return kTfLiteOk;
+}
+
+TfLiteStatus eval_cmsis_pointwise(TfLiteContext* context,
+                                  OpData* data,
+                                  const TfLiteEvalTensor* input,
+                                  const int8_t* filter_data,
+                                  const TfLiteEvalTensor* bias,
+                                  TfLiteEvalTensor* output,
+                                  int row_begin, int row_end,
+                                  int channel, int channels)
+{
+  const int in_channels  = data->op_params.in_channels;
+  const int out_channels = data->op_params.out_channels;
+
+  int pixel_begin, pixel_end;
+  pointwise_pixels(data, row_begin, row_end, &pixel_begin, &pixel_end);
+
+  // The output rows are out_channels apart, a tile of channels is written in
+  // place.
+  TF_LITE_ENSURE_EQ(context, ARM_CMSIS_NN_SUCCESS,
+                    arm_nn_mat_mult_nt_t_s8(
+                      tflite::micro::GetTensorData<int8_t>(input) + pixel_begin * in_channels,
+                      filter_data,
+                      bias == nullptr ? NULL : tflite::micro::GetTensorData<int32_t>(bias) + channel,
+                      tflite::micro::GetTensorData<int8_t>(output) + pixel_begin * out_channels + channel,
+                      data->per_channel_output_multiplier + channel,
+                      data->per_channel_output_shift + channel,
+                      pixel_end - pixel_begin, channels, in_channels,
+                      data->op_params.input_offset, data->op_params.output_offset,
+                      data->op_params.output_activation_min,
+                      data->op_params.output_activation_max,
+                      out_channels, in_channels));
+
+  return kTfLiteOk;
+}
+
 TfLiteStatus eval_cmsis_int8(TfLiteContext* context,
                              OpData* data,
                              const TfLiteEvalTensor* input,
-                             const TfLiteEvalTensor* filter,
+                             const int8_t* filter_data,
                              const TfLiteEvalTensor* bias,
-                             TfLiteEvalTensor* output)
+                             TfLiteEvalTensor* output,
+                             int row_begin, int row_end,
+                             int channel, int channels)
 {
+  const int8_t *input_data = tflite::micro::GetTensorData<int8_t>(input);
+  int8_t *output_data      = tflite::micro::GetTensorData<int8_t>(output);
+
   cmsis_nn_dims input_dims;
   input_dims.n = data->op_params.batches;
   input_dims.h = data->op_params.input_height;
@@ -292,7 +653,7 @@ TfLiteStatus eval_cmsis_int8(TfLiteContext* context,
   input_dims.c = data->op_params.in_channels;
 
   cmsis_nn_dims filter_dims;
-  filter_dims.n = data->op_params.out_channels;
+  filter_dims.n = channels;
   filter_dims.h = data->op_params.filter_height;
   filter_dims.w = data->op_params.filter_width;
   filter_dims.c = data->op_params.in_channels;
@@ -301,17 +662,17 @@ TfLiteStatus eval_cmsis_int8(TfLiteContext* context,
   bias_dims.n = 1;
   bias_dims.h = 1;
   bias_dims.w = 1;
-  bias_dims.c = data->op_params.out_channels;
+  bias_dims.c = channels;
 
   cmsis_nn_dims output_dims;
   output_dims.n = data->op_params.batches;
   output_dims.h = data->op_params.output_height;
   output_dims.w = data->op_params.output_width;
-  output_dims.c = data->op_params.out_channels;
+  output_dims.c = channels;
 
   cmsis_nn_per_channel_quant_params quant_params;
-  quant_params.multiplier = data->per_channel_output_multiplier;
-  quant_params.shift = data->per_channel_output_shift;
+  quant_params.multiplier = data->per_channel_output_multiplier + channel;
+  quant_params.shift = data->per_channel_output_shift + channel;
 
   cmsis_nn_conv_params       conv_params;
   conv_params.input_offset   = data->op_params.input_offset;
@@ -325,6 +686,16 @@ TfLiteStatus eval_cmsis_int8(TfLiteContext* context,
   conv_params.activation.min = data->op_params.output_activation_min;
   conv_params.activation.max = data->op_params.output_activation_max;
 
+  if (row_begin > 0 || row_end < output_dims.h) {
+    // Only compute a band of output rows
+    const streaming_conv::RowBand band = streaming_conv::Band(&data->streaming, row_begin, row_end);
+    input_data           += band.input_row * data->streaming.input_row_size;
+    input_dims.h          = band.input_rows;
+    conv_params.padding.h = band.pad_top;
+    output_data          += band.output_row * data->streaming.output_row_size;
+    output_dims.h         = band.output_rows;
+  }
+
   cmsis_nn_context ctx;
   ctx.buf = nullptr;
   ctx.size = 0;
@@ -332,14 +703,17 @@ TfLiteStatus eval_cmsis_int8(TfLiteContext* context,
   if (data->scratch_buffer_index > -1) {
     ctx.buf = context->GetScratchBuffer(context, data->scratch_buffer_index);
   }
+  int8_t *tile = tile_output(context, data, output_data, channels);
+  TF_LITE_ENSURE(context, tile != nullptr);
   TFLITE_DCHECK_EQ(ARM_CMSIS_NN_SUCCESS,
                    arm_convolve_wrapper_s8(
                      &ctx, &conv_params, &quant_params,
-                     &input_dims,  tflite::micro::GetTensorData<int8_t>(input),
-                     &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
-                     &bias_dims,   bias == nullptr ? NULL : tflite::micro::GetTensorData<int32_t>(bias),
-                     &output_dims, tflite::micro::GetTensorData<int8_t>(output)));
+                     &input_dims,  input_data,
+                     &filter_dims, filter_data,
+                     &bias_dims,   bias == nullptr ? NULL : tflite::micro::GetTensorData<int32_t>(bias) + channel,
+                     &output_dims, tile));
 
+  scatter_tile(data, tile, output_data, output_dims.n * output_dims.h * output_dims.w, channel, channels);
   return kTfLiteOk;
 }
 
@@ -392,11 +766,65 @@ TfLiteStatus Invoke(TfLiteContext* context, TfLiteNode* node)
                       : nullptr;
   auto output       = tflite::micro::GetEvalOutput(context, node, kOutputTensor);
 
-  if (data->supported == kMvp) {
-    status = eval_mvp_int8(context, data, input, filter, output);
+  if (data->supported != kTFLMrefF32) {
+    // Rows [reuse_begin, reuse_end) are restored from the streaming cache,
+    // the remaining rows are computed.
+    int reuse_begin, reuse_end;
+    const int shift = streaming_conv::Begin(&data->streaming, input, output,
+                                            &reuse_begin, &reuse_end);
+    const int bands[2][2] = { { 0, reuse_begin },
+                              { reuse_end, data->op_params.output_height } };
+
+    const bool compute = bands[0][0] < bands[0][1] || bands[1][0] < bands[1][1];
+    const int out_channels = data->op_params.out_channels;
+    const int channel_size = data->op_params.filter_height * data->op_params.filter_width
+                             * data->op_params.in_channels;
+    const int8_t *filter_data = tflite::micro::GetTensorData<int8_t>(filter);
+    int8_t *unpacked = nullptr;
+    if (compressed_weights::IsCompressed(data->filter_weights) && compute) {
+      unpacked = static_cast<int8_t*>(context->GetScratchBuffer(context, data->filter_scratch_index));
+      TF_LITE_ENSURE(context, unpacked != nullptr);
+    }
+
+    // Every tile of the filter is unpacked once and applied to all bands.
+    status = kTfLiteOk;
+    for (int channel = 0; compute && channel < out_channels && status == kTfLiteOk;
+         channel += data->filter_tile_channels) {
+      const int channels = std::min(data->filter_tile_channels, out_channels - channel);
+      const int8_t *tile = filter_data + channel * channel_size;
+      if (unpacked != nullptr) {
+        compressed_weights::Decompress(data->filter_weights, channel * channel_size,
+                                       channels * channel_size, unpacked);
+        tile = unpacked;
+      }
 
-  } else if (data->supported == kCmsisNN) {
-    status = eval_cmsis_int8(context, data, input, filter, bias, output);
+      for (int i = 0; i < 2 && status == kTfLiteOk; i++) {
+        if (bands[i][0] >= bands[i][1]) {
+          continue;
+        }
+        switch (data->supported) {
+          case kMvp:
+            status = eval_mvp_int8(context, data, input, tile, output,
+                                   bands[i][0], bands[i][1], channel, channels);
+            break;
+          case kMvpPointwise:
+            status = eval_mvp_pointwise(context, data, input, tile, output,
+                                        bands[i][0], bands[i][1], channel, channels);
+            break;
+          case kCmsisNNPointwise:
+            status = eval_cmsis_pointwise(context, data, input, tile, bias, output,
+                                          bands[i][0], bands[i][1], channel, channels);
+            break;
+          default:
+            status = eval_cmsis_int8(context, data, input, tile, bias, output,
+                                     bands[i][0], bands[i][1], channel, channels);
+            break;
+        }
+      }
+    }
+    if (status == kTfLiteOk) {
+      streaming_conv::End(&data->streaming, output, shift, reuse_begin, reuse_end);
+    }
 
   } else if (data->supported == kTFLMrefF32) {
     status = eval_float(params, data, input, filter, bias, output);
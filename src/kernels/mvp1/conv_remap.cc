@@ -0,0 +1,83 @@
+
+#include "conv_remap.h"
+
+#include <cstring>
+
+namespace tflite {
+namespace sl {
+namespace conv_remap {
+
+Axis Phase(int r, int dilation, int input_size, int output_size, int pad)
+{
+  Axis axis;
+  axis.output_start = r;
+  axis.output_size  = r < output_size ? (output_size - r + dilation - 1) / dilation : 0;
+
+  // Input index read by the first tap of the first output, the gathered
+  // input starts at the first index of the same phase that is not negative.
+  const int first = r - pad;
+  axis.input_start = ((first % dilation) + dilation) % dilation;
+  axis.input_size  = axis.input_start < input_size
+                     ? (input_size - axis.input_start + dilation - 1) / dilation
+                     : 1;
+  axis.pad = (axis.input_start - first) / dilation;
+  return axis;
+}
+
+int MaxInputSize(int dilation, int input_size)
+{
+  const int size = (input_size + dilation - 1) / dilation;
+  return size > 0 ? size : 1;
+}
+
+int MaxOutputSize(int dilation, int output_size)
+{
+  return (output_size + dilation - 1) / dilation;
+}
+
+void Gather(const int8_t* input, int input_height, int input_width,
+            int channels, int multiplier, int8_t fill,
+            const Axis& y, const Axis& x, int dilation_height, int dilation_width,
+            int8_t* dst)
+{
+  const int pixel_size = channels * multiplier;
+
+  for (int j = 0; j < y.input_size; j++) {
+    const int iy = y.input_start + j * dilation_height;
+    for (int i = 0; i < x.input_size; i++) {
+      const int ix = x.input_start + i * dilation_width;
+      if (iy >= input_height || ix >= input_width) {
+        memset(dst, fill, pixel_size);
+      } else {
+        const int8_t *src = input + (iy * input_width + ix) * channels;
+        if (multiplier == 1) {
+          memcpy(dst, src, channels);
+        } else {
+          for (int c = 0; c < channels; c++) {
+            memset(dst + c * multiplier, src[c], multiplier);
+          }
+        }
+      }
+      dst += pixel_size;
+    }
+  }
+}
+
+void Scatter(const int8_t* src, const Axis& y, const Axis& x,
+             int dilation_height, int dilation_width,
+             int output_width, int channels, int8_t* output)
+{
+  for (int q = 0; q < y.output_size; q++) {
+    const int oy = y.output_start + q * dilation_height;
+    int8_t *row = output + oy * output_width * channels;
+    for (int p = 0; p < x.output_size; p++) {
+      const int ox = x.output_start + p * dilation_width;
+      memcpy(row + ox * channels, src, channels);
+      src += channels;
+    }
+  }
+}
+
+}  // namespace conv_remap
+}  // namespace sl
+}  // namespace tflite
@@ -0,0 +1,49 @@
+
+#ifndef SL_MVP1_CONV_REMAP_H
+#define SL_MVP1_CONV_REMAP_H
+
+#include <cstdint>
+
+namespace tflite {
+namespace sl {
+namespace conv_remap {
+
+// A dilated convolution with unit stride splits into dilation x dilation
+// independent phases. Phase (ry, rx) computes the outputs at rows
+// ry + k * dilation_height and columns rx + k * dilation_width, and reads
+// only every dilation-th input row and column, starting at input_start. On
+// the gathered input each phase is a convolution without dilation.
+struct Axis {
+  int input_start;   // First input index read by the phase
+  int input_size;    // Gathered input size, at least 1
+  int output_start;  // First output index of the phase
+  int output_size;   // Number of outputs of the phase, may be 0
+  int pad;           // Leading padding of the gathered input
+};
+
+// Phase r of one axis with the given dilation and leading padding.
+Axis Phase(int r, int dilation, int input_size, int output_size, int pad);
+
+// Largest gathered input and output size of any phase of an axis.
+int MaxInputSize(int dilation, int input_size);
+int MaxOutputSize(int dilation, int output_size);
+
+// Gather the input of a phase, repeating every channel multiplier times so a
+// depth multiplier can run as a depthwise convolution with a multiplier of
+// 1. Rows and columns past the end of the input are filled with fill, the
+// input zero point.
+void Gather(const int8_t* input, int input_height, int input_width,
+            int channels, int multiplier, int8_t fill,
+            const Axis& y, const Axis& x, int dilation_height, int dilation_width,
+            int8_t* dst);
+
+// Store the output of a phase at its interleaved positions.
+void Scatter(const int8_t* src, const Axis& y, const Axis& x,
+             int dilation_height, int dilation_width,
+             int output_width, int channels, int8_t* output);
+
+}  // namespace conv_remap
+}  // namespace sl
+}  // namespace tflite
+
+#endif  // SL_MVP1_CONV_REMAP_H
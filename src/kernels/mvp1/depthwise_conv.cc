@@ -7,6 +7,10 @@
 #include "Include/arm_nnfunctions.h"
 
 #include "sl_mvp_ml_depthwise_conv2d.h"
+#include "streaming_conv.h"
+#include "conv_remap.h"
+#include "depthwise_conv_unrolled.h"
+#include "kernel_backend.h"
 
 namespace tflite {
 namespace sl {
@@ -21,7 +25,7 @@ constexpr int kOutputTensor = 0;
 // https://www.tensorflow.org/lite/performance/quantization_spec
 constexpr int kDepthwiseConvQuantizedDimension = 3;
 
-enum op_support { kMvp, kCmsisNN, kTFLMrefF32 };
+enum op_support { kMvp, kCmsisNN, kCpuUnrolled, kTFLMrefF32 };
 
 struct OpData {
   op_support  supported;
@@ -33,6 +37,18 @@ struct OpData {
   // CMSIS-NN per channel output multiplier and shift.
   int32_t     *per_channel_output_multiplier;
   int32_t     *per_channel_output_shift;
+
+  // Depth multipliers and dilation run on the MVP as depthwise convolutions
+  // without these features on a remapped input, see conv_remap.h. The
+  // scratch buffer holds the gathered input followed by the phase output.
+  bool        remap;
+  int         remap_input_size;
+
+  // Bias and input offset folded per channel, used by kCpuUnrolled.
+  int32_t     *kernel_sum;
+
+  // Output row cache used when running on a sliding window input.
+  streaming_conv::State streaming;
 };
 
 inline float16_t normalize_fp16(float f)
@@ -53,6 +69,75 @@ inline PaddingType RuntimePaddingType(TfLitePadding padding)
   }
 }
 
+// Dilation only matters along axes where the filter has several taps.
+inline int phase_dilation(int filter_size, int dilation)
+{
+  return filter_size > 1 ? dilation : 1;
+}
+
+// Parameters of the MVP depthwise convolution of one phase of a remapped
+// input, the depth multiplier is 1 and the phase is not dilated.
+sli_mvp_ml_depthwise_conv2d_s8_params_t remap_params(
+    const sli_mvp_ml_depthwise_conv2d_s8_params_t& params,
+    const conv_remap::Axis& y, const conv_remap::Axis& x)
+{
+  sli_mvp_ml_depthwise_conv2d_s8_params_t phase = params;
+  phase.batches         = 1;
+  phase.in_channels     = params.out_channels;
+  phase.input_height    = y.input_size;
+  phase.input_width     = x.input_size;
+  phase.output_height   = y.output_size;
+  phase.output_width    = x.output_size;
+  phase.pad_height      = y.pad;
+  phase.pad_width       = x.pad;
+  phase.dilation_height = 1;
+  phase.dilation_width  = 1;
+  return phase;
+}
+
+// Check if the MVP supports the convolution, natively or on a remapped
+// input. Dilation is only remapped for a unit stride. The scratch sizes of
+// the remapped input and phase output are returned when remapping.
+bool mvp_is_supported(const sli_mvp_ml_depthwise_conv2d_s8_params_t& params,
+                      bool* remap, int* remap_input_size, int* remap_output_size)
+{
+  const int multiplier = params.out_channels / params.in_channels;
+  const int dilation_height = phase_dilation(params.filter_height, params.dilation_height);
+  const int dilation_width  = phase_dilation(params.filter_width, params.dilation_width);
+  const bool dilated = dilation_height > 1 || dilation_width > 1;
+
+  *remap = false;
+  *remap_input_size = 0;
+  *remap_output_size = 0;
+
+  if (multiplier == 1 && !dilated) {
+    return sli_mvp_ml_depthwise_conv2d_s8_is_supported(&params);
+  }
+  if (multiplier * params.in_channels != params.out_channels
+      || (dilated && (params.stride_height != 1 || params.stride_width != 1))) {
+    return false;
+  }
+
+  // The first phase has the largest input and output.
+  conv_remap::Axis y = conv_remap::Phase(0, dilation_height, params.input_height,
+                                         params.output_height, params.pad_height);
+  conv_remap::Axis x = conv_remap::Phase(0, dilation_width, params.input_width,
+                                         params.output_width, params.pad_width);
+  y.input_size = conv_remap::MaxInputSize(dilation_height, params.input_height);
+  x.input_size = conv_remap::MaxInputSize(dilation_width, params.input_width);
+  const sli_mvp_ml_depthwise_conv2d_s8_params_t phase = remap_params(params, y, x);
+  if (!sli_mvp_ml_depthwise_conv2d_s8_is_supported(&phase)) {
+    return false;
+  }
+
+  *remap = true;
+  *remap_input_size = y.input_size * x.input_size * params.out_channels;
+  if (dilated) {
+    *remap_output_size = y.output_size * x.output_size * params.out_channels;
+  }
+  return true;
+}
+
 TfLiteStatus PopulateConvolutionQuantizationParams(
     TfLiteContext* context,
     const TfLiteTensor* input,
@@ -150,9 +235,16 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
 
   const int num_channels = data->op_params.out_channels;
 
+  data->remap = false;
+  data->remap_input_size = 0;
+
   if (input->type == kTfLiteInt8) {
-    if (sli_mvp_ml_depthwise_conv2d_s8_is_supported(&data->op_params)) {
+    int remap_output_size = 0;
+    if (kernel_backend::MvpEnabled()
+        && mvp_is_supported(data->op_params, &data->remap,
+                            &data->remap_input_size, &remap_output_size)) {
       data->supported = kMvp;
+      scratch_buffer_size = data->remap_input_size + remap_output_size;
 
       float16_t *bias_data = static_cast<float16_t*>(context->AllocatePersistentBuffer(
                              context, num_channels * sizeof(float16_t)));
@@ -223,8 +315,35 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
 
       scratch_buffer_size = arm_depthwise_conv_wrapper_s8_get_buffer_size(
                             &dw_conv_params, &input_dims, &filter_dims, &output_dims);
+
+#if SL_TFLITE_MICRO_DEPTHWISE_UNROLLED_ENABLE
+      // The kernel sum is computed once, this requires a constant filter.
+      if (kernel_backend::SpecializedEnabled()
+          && IsConstantTensor(filter)
+          && (bias == nullptr || IsConstantTensor(bias))
+          && depthwise_conv_unrolled::IsSupported(
+               data->op_params.filter_height, data->op_params.filter_width,
+               data->op_params.stride_height, data->op_params.stride_width,
+               data->op_params.dilation_height, data->op_params.dilation_width,
+               dw_conv_params.ch_mult)) {
+        data->supported = kCpuUnrolled;
+        scratch_buffer_size = 0;
+        data->kernel_sum = static_cast<int32_t*>(context->AllocatePersistentBuffer(
+                           context, num_channels * sizeof(int32_t)));
+        TF_LITE_ENSURE(context, data->kernel_sum != nullptr);
+        depthwise_conv_unrolled::KernelSum(
+          filter->data.int8, bias == nullptr ? nullptr : bias->data.i32,
+          data->op_params.filter_height, num_channels,
+          data->op_params.input_offset, data->kernel_sum);
+      }
+#endif
     }
 
+    TF_LITE_ENSURE_STATUS(streaming_conv::Prepare(
+      context, &data->streaming, node->inputs->data[kInputTensor], input, output,
+      data->op_params.stride_height, data->op_params.dilation_height,
+      data->op_params.filter_height, data->op_params.pad_height));
+
   } else if (input->type == kTfLiteFloat32) {
     data->supported = kTFLMrefF32;
     CalculateActivationRange(params->activation,
@@ -237,6 +356,11 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
     return kTfLiteError;
   }
 
+  kernel_backend::Report(data->supported == kMvp           ? kernel_backend::kMvp
+                         : data->supported == kCmsisNN     ? kernel_backend::kCmsisNN
+                         : data->supported == kCpuUnrolled ? kernel_backend::kCpuUnrolled
+                         : kernel_backend::kReference);
+
   if(scratch_buffer_size > 0) {
     TF_LITE_ENSURE_STATUS(
       context->RequestScratchBufferInArena(
@@ -255,17 +379,84 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
   return kTfLiteOk;
 }
 
+TfLiteStatus eval_mvp_remap(TfLiteContext* context,
+                            const OpData* data,
+                            const sli_mvp_ml_depthwise_conv2d_s8_params_t& params)
+{
+  int8_t *gathered = static_cast<int8_t*>(context->GetScratchBuffer(context, data->scratch_buffer_index));
+  TF_LITE_ENSURE(context, gathered != nullptr);
+  int8_t *phase_output = gathered + data->remap_input_size;
+
+  const int multiplier = params.out_channels / params.in_channels;
+  const int dilation_height = phase_dilation(params.filter_height, params.dilation_height);
+  const int dilation_width  = phase_dilation(params.filter_width, params.dilation_width);
+  const bool dilated = dilation_height > 1 || dilation_width > 1;
+  const int8_t zero_point = static_cast<int8_t>(-params.input_offset);
+
+  for (int b = 0; b < params.batches; b++) {
+    const int8_t *input = params.input
+                          + b * params.input_height * params.input_width * params.in_channels;
+    int8_t *output = params.output
+                     + b * params.output_height * params.output_width * params.out_channels;
+
+    for (int ry = 0; ry < dilation_height; ry++) {
+      const conv_remap::Axis y = conv_remap::Phase(ry, dilation_height, params.input_height,
+                                                   params.output_height, params.pad_height);
+      for (int rx = 0; rx < dilation_width; rx++) {
+        const conv_remap::Axis x = conv_remap::Phase(rx, dilation_width, params.input_width,
+                                                     params.output_width, params.pad_width);
+        if (y.output_size == 0 || x.output_size == 0) {
+          continue;
+        }
+
+        conv_remap::Gather(input, params.input_height, params.input_width,
+                           params.in_channels, multiplier, zero_point,
+                           y, x, dilation_height, dilation_width, gathered);
+
+        sli_mvp_ml_depthwise_conv2d_s8_params_t phase = remap_params(params, y, x);
+        phase.input  = gathered;
+        phase.output = dilated ? phase_output : output;
+        sl_status_t status = sli_mvp_ml_depthwise_conv2d_s8(&phase);
+        TF_LITE_ENSURE_EQ(context, SL_STATUS_OK, status);
+
+        if (dilated) {
+          conv_remap::Scatter(phase_output, y, x, dilation_height, dilation_width,
+                              params.output_width, params.out_channels, output);
+        }
+      }
+    }
+  }
+
+  return kTfLiteOk;
+}
+
 TfLiteStatus eval_mvp_int8(TfLiteContext* context,
                            OpData* data,
                            const TfLiteEvalTensor* input,
                            const TfLiteEvalTensor* filter,
-                           TfLiteEvalTensor* output)
+                           TfLiteEvalTensor* output,
+                           int row_begin, int row_end)
 {
   data->op_params.input  = tflite::micro::GetTensorData<int8_t>(input);
   data->op_params.output = tflite::micro::GetTensorData<int8_t>(output);
   data->op_params.filter = tflite::micro::GetTensorData<int8_t>(filter);
 
-  sl_status_t status = sli_mvp_ml_depthwise_conv2d_s8(&data->op_params);
+  sli_mvp_ml_depthwise_conv2d_s8_params_t params = data->op_params;
+  if (row_begin > 0 || row_end < params.output_height) {
+    // Only compute a band of output rows
+    const streaming_conv::RowBand band = streaming_conv::Band(&data->streaming, row_begin, row_end);
+    params.input         += band.input_row * data->streaming.input_row_size;
+    params.input_height   = band.input_rows;
+    params.pad_height     = band.pad_top;
+    params.output        += band.output_row * data->streaming.output_row_size;
+    params.output_height  = band.output_rows;
+  }
+
+  if (data->remap) {
+    return eval_mvp_remap(context, data, params);
+  }
+
+  sl_status_t status = sli_mvp_ml_depthwise_conv2d_s8(&params);
   TF_LITE_ENSURE_EQ(context, SL_STATUS_OK, status);
 
   return status == SL_STATUS_OK ? kTfLiteOk : kTfLiteError;
@@ -276,8 +467,12 @@ TfLiteStatus eval_cmsis_int8(TfLiteContext* context,
                              const TfLiteEvalTensor* input,
                              const TfLiteEvalTensor* filter,
                              const TfLiteEvalTensor* bias,
-                             TfLiteEvalTensor* output)
+                             TfLiteEvalTensor* output,
+                             int row_begin, int row_end)
 {
+  const int8_t *input_data = tflite::micro::GetTensorData<int8_t>(input);
+  int8_t *output_data      = tflite::micro::GetTensorData<int8_t>(output);
+
   cmsis_nn_dims input_dims;
   input_dims.n = data->op_params.batches;
   input_dims.h = data->op_params.input_height;
@@ -319,6 +514,16 @@ TfLiteStatus eval_cmsis_int8(TfLiteContext* context,
   dw_conv_params.activation.max = data->op_params.output_activation_max;
   dw_conv_params.ch_mult        = data->op_params.out_channels / data->op_params.in_channels;
 
+  if (row_begin > 0 || row_end < output_dims.h) {
+    // Only compute a band of output rows
+    const streaming_conv::RowBand band = streaming_conv::Band(&data->streaming, row_begin, row_end);
+    input_data              += band.input_row * data->streaming.input_row_size;
+    input_dims.h             = band.input_rows;
+    dw_conv_params.padding.h = band.pad_top;
+    output_data             += band.output_row * data->streaming.output_row_size;
+    output_dims.h            = band.output_rows;
+  }
+
   cmsis_nn_context ctx;
   ctx.buf = nullptr;
   ctx.size = 0;
@@ -329,11 +534,57 @@ TfLiteStatus eval_cmsis_int8(TfLiteContext* context,
   TFLITE_DCHECK_EQ(ARM_CMSIS_NN_SUCCESS,
                    arm_depthwise_conv_wrapper_s8(
                      &ctx, &dw_conv_params, &quant_params,
-                     &input_dims,  tflite::micro::GetTensorData<int8_t>(input),
+                     &input_dims,  input_data,
                      &filter_dims, tflite::micro::GetTensorData<int8_t>(filter),
                      &bias_dims,   bias == nullptr ? NULL : tflite::micro::GetTensorData<int32_t>(bias),
-                     &output_dims, tflite::micro::GetTensorData<int8_t>(output)));
+                     &output_dims, output_data));
+
+  return kTfLiteOk;
+}
+
+TfLiteStatus eval_unrolled_int8(OpData* data,
+                                const TfLiteEvalTensor* input,
+                                const TfLiteEvalTensor* filter,
+                                const TfLiteEvalTensor* bias,
+                                TfLiteEvalTensor* output,
+                                int row_begin, int row_end)
+{
+  const int8_t *input_data = tflite::micro::GetTensorData<int8_t>(input);
+  int8_t *output_data      = tflite::micro::GetTensorData<int8_t>(output);
+
+  depthwise_conv_unrolled::Params params;
+  params.batches        = data->op_params.batches;
+  params.input_height   = data->op_params.input_height;
+  params.input_width    = data->op_params.input_width;
+  params.channels       = data->op_params.in_channels;
+  params.output_height  = data->op_params.output_height;
+  params.output_width   = data->op_params.output_width;
+  params.filter_size    = data->op_params.filter_height;
+  params.stride         = data->op_params.stride_height;
+  params.pad_height     = data->op_params.pad_height;
+  params.pad_width      = data->op_params.pad_width;
+  params.input_offset   = data->op_params.input_offset;
+  params.output_offset  = data->op_params.output_offset;
+  params.activation_min = data->op_params.output_activation_min;
+  params.activation_max = data->op_params.output_activation_max;
+  params.multiplier     = data->per_channel_output_multiplier;
+  params.shift          = data->per_channel_output_shift;
+  params.kernel_sum     = data->kernel_sum;
+
+  if (row_begin > 0 || row_end < params.output_height) {
+    // Only compute a band of output rows
+    const streaming_conv::RowBand band = streaming_conv::Band(&data->streaming, row_begin, row_end);
+    input_data           += band.input_row * data->streaming.input_row_size;
+    params.input_height   = band.input_rows;
+    params.pad_height     = band.pad_top;
+    output_data          += band.output_row * data->streaming.output_row_size;
+    params.output_height  = band.output_rows;
+  }
 
+  depthwise_conv_unrolled::Eval(params, input_data,
+                                tflite::micro::GetTensorData<int8_t>(filter),
+                                bias == nullptr ? nullptr : tflite::micro::GetTensorData<int32_t>(bias),
+                                output_data);
   return kTfLiteOk;
 }
 
@@ -386,11 +637,30 @@ TfLiteStatus Invoke(TfLiteContext* context, TfLiteNode* node)
                       : nullptr;
   auto output       = tflite::micro::GetEvalOutput(context, node, kOutputTensor);
 
-  if (data->supported == kMvp) {
-    status = eval_mvp_int8(context, data, input, filter, output);
-
-  } else if (data->supported == kCmsisNN) {
-    status = eval_cmsis_int8(context, data, input, filter, bias, output);
+  if (data->supported != kTFLMrefF32) {
+    // Rows [reuse_begin, reuse_end) are restored from the streaming cache,
+    // the remaining rows are computed.
+    int reuse_begin, reuse_end;
+    const int shift = streaming_conv::Begin(&data->streaming, input, output,
+                                            &reuse_begin, &reuse_end);
+    const int bands[2][2] = { { 0, reuse_begin },
+                              { reuse_end, data->op_params.output_height } };
+    status = kTfLiteOk;
+    for (int i = 0; i < 2 && status == kTfLiteOk; i++) {
+      if (bands[i][0] >= bands[i][1]) {
+        continue;
+      }
+      if (data->supported == kMvp) {
+        status = eval_mvp_int8(context, data, input, filter, output, bands[i][0], bands[i][1]);
+      } else if (data->supported == kCpuUnrolled) {
+        status = eval_unrolled_int8(data, input, filter, bias, output, bands[i][0], bands[i][1]);
+      } else {
+        status = eval_cmsis_int8(context, data, input, filter, bias, output, bands[i][0], bands[i][1]);
+      }
+    }
+    if (status == kTfLiteOk) {
+      streaming_conv::End(&data->streaming, output, shift, reuse_begin, reuse_end);
+    }
 
   } else if (data->supported == kTFLMrefF32) {
     status = eval_float(params, data, input, filter, bias, output);
@@ -0,0 +1,165 @@
+
+#include "depthwise_conv_unrolled.h"
+
+#include "Include/arm_nnsupportfunctions.h"
+
+namespace tflite {
+namespace sl {
+namespace depthwise_conv_unrolled {
+
+namespace {
+
+inline int8_t requantize(const Params& p, int channel, int32_t acc)
+{
+  acc = arm_nn_requantize(acc, p.multiplier[channel], p.shift[channel]);
+  acc += p.output_offset;
+  acc = acc < p.activation_min ? p.activation_min : acc;
+  acc = acc > p.activation_max ? p.activation_max : acc;
+  return static_cast<int8_t>(acc);
+}
+
+// Output pixel whose taps all lie inside the input. The tap loops have a
+// constant trip count and are fully unrolled, the input offset is part of
+// the kernel sum.
+template <int kSize>
+inline void pixel_inner(const Params& p, const int8_t* in, const int8_t* filter, int8_t* out)
+{
+  const int channels = p.channels;
+  const int row_size = p.input_width * channels;
+
+  for (int c = 0; c < channels; c++) {
+    int32_t acc = p.kernel_sum[c];
+    const int8_t *in_c = in + c;
+    const int8_t *filter_c = filter + c;
+    for (int ky = 0; ky < kSize; ky++) {
+      for (int kx = 0; kx < kSize; kx++) {
+        acc += in_c[ky * row_size + kx * channels] * filter_c[(ky * kSize + kx) * channels];
+      }
+    }
+    out[c] = requantize(p, c, acc);
+  }
+}
+
+// Output pixel next to the padding, only the taps in [ky_begin, ky_end) x
+// [kx_begin, kx_end) lie inside the input. Padding is the input zero point,
+// which adds nothing to the accumulator.
+template <int kSize>
+inline void pixel_border(const Params& p, const int8_t* in, const int8_t* filter,
+                         const int32_t* bias, int ky_begin, int ky_end,
+                         int kx_begin, int kx_end, int8_t* out)
+{
+  const int channels = p.channels;
+  const int row_size = p.input_width * channels;
+
+  for (int c = 0; c < channels; c++) {
+    int32_t acc = bias != nullptr ? bias[c] : 0;
+    for (int ky = ky_begin; ky < ky_end; ky++) {
+      for (int kx = kx_begin; kx < kx_end; kx++) {
+        acc += (in[ky * row_size + kx * channels + c] + p.input_offset)
+               * filter[(ky * kSize + kx) * channels + c];
+      }
+    }
+    out[c] = requantize(p, c, acc);
+  }
+}
+
+// First and end output index whose taps all lie inside the input.
+template <int kSize, int kStride>
+inline void inner_range(int input_size, int output_size, int pad, int* begin, int* end)
+{
+  *begin = (pad + kStride - 1) / kStride;
+  *end = input_size + pad >= kSize ? (input_size + pad - kSize) / kStride + 1 : 0;
+  *begin = *begin < output_size ? *begin : output_size;
+  *end = *end < *begin ? *begin : (*end < output_size ? *end : output_size);
+}
+
+template <int kSize, int kStride>
+void depthwise_conv(const Params& p, const int8_t* input, const int8_t* filter,
+                    const int32_t* bias, int8_t* output)
+{
+  const int channels = p.channels;
+  const int row_size = p.input_width * channels;
+
+  int y_begin, y_end, x_begin, x_end;
+  inner_range<kSize, kStride>(p.input_height, p.output_height, p.pad_height, &y_begin, &y_end);
+  inner_range<kSize, kStride>(p.input_width, p.output_width, p.pad_width, &x_begin, &x_end);
+
+  for (int b = 0; b < p.batches; b++) {
+    const int8_t *in_batch = input + b * p.input_height * row_size;
+
+    for (int y = 0; y < p.output_height; y++) {
+      const int in_y = y * kStride - p.pad_height;
+      const int ky_begin = in_y < 0 ? -in_y : 0;
+      const int ky_end = in_y + kSize > p.input_height ? p.input_height - in_y : kSize;
+      const bool row_inner = y >= y_begin && y < y_end;
+
+      for (int x = 0; x < p.output_width; x++) {
+        const int in_x = x * kStride - p.pad_width;
+        const int8_t *in = in_batch + in_y * row_size + in_x * channels;
+
+        if (row_inner && x >= x_begin && x < x_end) {
+          pixel_inner<kSize>(p, in, filter, output);
+        } else {
+          const int kx_begin = in_x < 0 ? -in_x : 0;
+          const int kx_end = in_x + kSize > p.input_width ? p.input_width - in_x : kSize;
+          pixel_border<kSize>(p, in, filter, bias, ky_begin, ky_end, kx_begin, kx_end, output);
+        }
+        output += channels;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+bool IsSupported(int filter_height, int filter_width,
+                 int stride_height, int stride_width,
+                 int dilation_height, int dilation_width,
+                 int depth_multiplier)
+{
+  return filter_height == filter_width
+         && (filter_height == 3 || filter_height == 5)
+         && stride_height == stride_width
+         && (stride_height == 1 || stride_height == 2)
+         && dilation_height == 1 && dilation_width == 1
+         && depth_multiplier == 1;
+}
+
+void KernelSum(const int8_t* filter, const int32_t* bias,
+               int filter_size, int channels, int32_t input_offset,
+               int32_t* kernel_sum)
+{
+  for (int c = 0; c < channels; c++) {
+    int32_t sum = 0;
+    for (int k = 0; k < filter_size * filter_size; k++) {
+      sum += filter[k * channels + c];
+    }
+    kernel_sum[c] = (bias != nullptr ? bias[c] : 0) + input_offset * sum;
+  }
+}
+
+void Eval(const Params& params, const int8_t* input, const int8_t* filter,
+          const int32_t* bias, int8_t* output)
+{
+  switch (params.filter_size * 10 + params.stride) {
+    case 31:
+      depthwise_conv<3, 1>(params, input, filter, bias, output);
+      break;
+    case 32:
+      depthwise_conv<3, 2>(params, input, filter, bias, output);
+      break;
+    case 51:
+      depthwise_conv<5, 1>(params, input, filter, bias, output);
+      break;
+    case 52:
+      depthwise_conv<5, 2>(params, input, filter, bias, output);
+      break;
+    default:
+      // Rejected by IsSupported()
+      break;
+  }
+}
+
+}  // namespace depthwise_conv_unrolled
+}  // namespace sl
+}  // namespace tflite
@@ -0,0 +1,68 @@
+
+#ifndef SL_MVP1_DEPTHWISE_CONV_UNROLLED_H
+#define SL_MVP1_DEPTHWISE_CONV_UNROLLED_H
+
+#include <cstdint>
+
+#include "sl_tflite_micro_config.h"
+
+// Select the unrolled kernels in the depthwise convolution. Disabled by
+// default, the CMSIS-NN kernels are used.
+#ifndef SL_TFLITE_MICRO_DEPTHWISE_UNROLLED_ENABLE
+#define SL_TFLITE_MICRO_DEPTHWISE_UNROLLED_ENABLE (0)
+#endif
+
+namespace tflite {
+namespace sl {
+namespace depthwise_conv_unrolled {
+
+// Geometry and quantization of an int8 depthwise convolution with a depth
+// multiplier of 1, square filter and stride, and no dilation.
+struct Params {
+  int     batches;
+  int     input_height;
+  int     input_width;
+  int     channels;
+  int     output_height;
+  int     output_width;
+  int     filter_size;
+  int     stride;
+  int     pad_height;
+  int     pad_width;
+  int32_t input_offset;
+  int32_t output_offset;
+  int32_t activation_min;
+  int32_t activation_max;
+
+  // CMSIS-NN per channel output multiplier and shift.
+  const int32_t *multiplier;
+  const int32_t *shift;
+
+  // Bias plus input_offset times the sum of the filter taps, per channel,
+  // see KernelSum().
+  const int32_t *kernel_sum;
+};
+
+// Filter sizes and strides with an unrolled implementation: 3x3 and 5x5
+// filters with a stride of 1 or 2.
+bool IsSupported(int filter_height, int filter_width,
+                 int stride_height, int stride_width,
+                 int dilation_height, int dilation_width,
+                 int depth_multiplier);
+
+// Fold the input offset of the taps inside the input into the bias.
+void KernelSum(const int8_t* filter, const int32_t* bias,
+               int filter_size, int channels, int32_t input_offset,
+               int32_t* kernel_sum);
+
+// Compute the convolution. The filter is [1, filter_size, filter_size,
+// channels], the bias is only read for outputs next to the padding and may
+// be null.
+void Eval(const Params& params, const int8_t* input, const int8_t* filter,
+          const int32_t* bias, int8_t* output);
+
+}  // namespace depthwise_conv_unrolled
+}  // namespace sl
+}  // namespace tflite
+
+#endif  // SL_MVP1_DEPTHWISE_CONV_UNROLLED_H
@@ -0,0 +1,88 @@
+
+#include "tensorflow/lite/micro/kernels/dequantize.h"
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+
+#include "kernel_backend.h"
+#include "type_conversion.h"
+
+namespace tflite {
+namespace sl {
+namespace dequantize {
+
+// The reference Prepare and Eval take the user data as DequantizeOpData, it
+// must stay the first member.
+struct OpData {
+  DequantizeOpData reference;
+  bool use_unrolled;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(DequantizePrepare(context, node));
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  OpData* data = static_cast<OpData*>(node->user_data);
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, 0);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, 0);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  // int8 and int16 to float have unrolled implementations.
+  data->use_unrolled = kernel_backend::SpecializedEnabled()
+                       && output->type == kTfLiteFloat32
+                       && (input->type == kTfLiteInt8 || input->type == kTfLiteInt16);
+  kernel_backend::Report(data->use_unrolled ? kernel_backend::kCpuUnrolled
+                                            : kernel_backend::kReference);
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *static_cast<const OpData*>(node->user_data);
+
+  if (!data.use_unrolled) {
+    return DequantizeEval(context, node);
+  }
+
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, 0);
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, 0);
+  const int size = MatchingFlatSize(tflite::micro::GetTensorShape(input),
+                                    tflite::micro::GetTensorShape(output));
+  // The double holds the float scale of the input tensor, the conversion is
+  // exact.
+  const float scale = static_cast<float>(data.reference.quantization_params.scale);
+  const int32_t zero_point = data.reference.quantization_params.zero_point;
+
+  if (input->type == kTfLiteInt8) {
+    type_conversion::Dequantize(tflite::micro::GetTensorData<int8_t>(input),
+                                tflite::micro::GetTensorData<float>(output),
+                                size, scale, zero_point);
+  } else {
+    type_conversion::Dequantize(tflite::micro::GetTensorData<int16_t>(input),
+                                tflite::micro::GetTensorData<float>(output),
+                                size, scale, zero_point);
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace dequantize
+}  // namespace sl
+
+TFLMRegistration Register_DEQUANTIZE() {
+  return tflite::micro::RegisterOp(sl::dequantize::Init, sl::dequantize::Prepare, sl::dequantize::Eval);
+}
+
+}  // namespace tflite
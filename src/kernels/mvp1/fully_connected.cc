@@ -1,7 +1,11 @@
 
 #include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "Include/arm_nnfunctions.h"
+#include "Include/arm_nnsupportfunctions.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/common.h"
@@ -13,6 +17,8 @@
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 
 #include "sl_mvp_ml_fully_connected.h"
+#include "compressed_weights.h"
+#include "kernel_backend.h"
 
 namespace tflite {
 namespace sl {
@@ -24,6 +30,27 @@ struct OpData {
   sli_mvp_ml_fully_connected_s8_params_t op_params;
   float16_t *bias_fp16;
   bool use_mvp;
+
+  // Compressed weights are unpacked to int8 in tiles of tile_rows output
+  // units right before the tile is computed. Block sparse weights are
+  // computed one row of blocks at a time, with tile_rows equal to the block
+  // height, and the scratch buffer holding the gathered input.
+  compressed_weights::Weights weights;
+  int tile_rows;
+  int tile_scratch_index;
+  int32_t *zero_bias;
+
+  // Batches are computed together, batch_group at a time, so that every
+  // weight row is read once per group instead of once per batch. The MVP
+  // writes the outputs of a tile to output_scratch_index when the tile does
+  // not cover all units. The batched CPU path takes the output multiplier
+  // and shift per unit.
+  int batches;
+  int batch_group;
+  int output_scratch_index;
+  bool batched;
+  int32_t *unit_multiplier;
+  int32_t *unit_shift;
 };
 
 constexpr int kInputTensor = 0;
@@ -47,6 +74,14 @@ sli_nn_shape_t dims2shape(const TfLiteIntArray *dim)
   return shape;
 }
 
+sli_nn_shape_t shape2d(int rows, int cols)
+{
+  sli_nn_shape_t shape = {0};
+  shape.dim[0] = rows;
+  shape.dim[1] = cols;
+  return shape;
+}
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
   return context->AllocatePersistentBuffer(context, sizeof(OpData));
@@ -87,9 +122,15 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     bias_len = bias_shape.FlatSize();
   }
 
+  data->weights.format = compressed_weights::kWeightsInt8;
+
   if (input->type == kTfLiteInt8) {
     TF_LITE_ENSURE_STATUS(CalculateActivationRangeQuantized(
     context, params->activation, output, &output_min, &output_max));
+    TF_LITE_ENSURE_STATUS(compressed_weights::Prepare(context, weight, &data->weights));
+    if (compressed_weights::IsCompressed(data->weights)) {
+      TF_LITE_ENSURE_EQ(context, data->weights.dims->size, 2);
+    }
 
     double real_multiplier = 0.0;
     TF_LITE_ENSURE_STATUS(GetQuantizedConvolutionMultipler(
@@ -99,7 +140,7 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     data->op_params.input_shape = dims2shape(input->dims);
     data->op_params.input_offset = -input->params.zero_point;
     data->op_params.weight = GetTensorData<int8_t>(weight);
-    data->op_params.weight_shape = dims2shape(weight->dims);
+    data->op_params.weight_shape = dims2shape(data->weights.dims);
     data->op_params.weight_offset = -weight->params.zero_point;
     data->op_params.bias = nullptr;
     data->op_params.bias_length = bias_len;
@@ -110,7 +151,93 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
     data->op_params.activation_min = static_cast<int8_t>(output_min);
     data->op_params.activation_max = static_cast<int8_t>(output_max);
 
-    data->use_mvp = sli_mvp_ml_fully_connected_s8_is_supported(&data->op_params);
+    const int units = output->dims->data[output->dims->size - 1];
+    const int depth = data->weights.dims->data[data->weights.dims->size - 1];
+    TF_LITE_ENSURE_EQ(context, data->weights.dims->data[0], units);
+    data->batches = static_cast<int>(NumElements(output)) / units;
+    data->batch_group = std::min(data->batches, SLI_MVP_MAX_DIM_SIZE);
+    data->output_scratch_index = -1;
+
+    if (data->weights.format == compressed_weights::kWeightsBlockSparse) {
+      const compressed_weights::Weights& w = data->weights;
+      const int row_blocks = w.dims->data[0] / w.block_rows;
+      data->tile_rows = w.block_rows;
+      TF_LITE_ENSURE_EQ(context, weight->params.zero_point, 0);
+
+      // All rows of blocks must be supported by the MVP, rows without any
+      // nonzero block are computed on the CPU.
+      data->use_mvp = kernel_backend::MvpEnabled();
+      int max_blocks = 1;
+      for (int r = 0; r < row_blocks; r++) {
+        const int blocks = w.block_ptr[r + 1] - w.block_ptr[r];
+        if (blocks == 0) {
+          continue;
+        }
+        max_blocks = std::max(max_blocks, blocks);
+        sli_mvp_ml_fully_connected_s8_params_t block_params = data->op_params;
+        block_params.input_shape = shape2d(data->batch_group, blocks * w.block_cols);
+        block_params.weight_shape = shape2d(w.block_rows, blocks * w.block_cols);
+        block_params.bias_length = bias ? w.block_rows : 0;
+        block_params.output_shape = shape2d(data->batch_group, w.block_rows);
+        data->use_mvp = data->use_mvp && sli_mvp_ml_fully_connected_s8_is_supported(&block_params);
+      }
+      data->batched = !data->use_mvp && data->batches > 1 && kernel_backend::SpecializedEnabled();
+
+      // The input segments of all batches of a group are gathered, unless
+      // the batches are computed one at a time.
+      const int gathered_batches = (data->use_mvp || data->batched) ? data->batch_group : 1;
+      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, gathered_batches * max_blocks * w.block_cols, &data->tile_scratch_index));
+
+      data->zero_bias = nullptr;
+      if (!data->use_mvp && !bias) {
+        data->zero_bias = static_cast<int32_t *>(context->AllocatePersistentBuffer(context, data->tile_rows * sizeof(int32_t)));
+        if (data->zero_bias == nullptr) {
+          return kTfLiteError;
+        }
+        memset(data->zero_bias, 0, data->tile_rows * sizeof(int32_t));
+      }
+    } else if (compressed_weights::IsCompressed(data->weights)) {
+      data->tile_rows = std::max(1, std::min(units, SL_TFLITE_MICRO_WEIGHT_TILE_SIZE / depth));
+      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, data->tile_rows * depth, &data->tile_scratch_index));
+
+      // Every tile is computed for a group of batches at a time.
+      sli_mvp_ml_fully_connected_s8_params_t tile_params = data->op_params;
+      tile_params.input_shape = shape2d(data->batch_group, depth);
+      tile_params.weight_shape = shape2d(data->tile_rows, depth);
+      tile_params.bias_length = bias ? data->tile_rows : 0;
+      tile_params.output_shape = shape2d(data->batch_group, data->tile_rows);
+      data->use_mvp = kernel_backend::MvpEnabled()
+                      && sli_mvp_ml_fully_connected_s8_is_supported(&tile_params);
+      data->batched = !data->use_mvp && data->batches > 1 && kernel_backend::SpecializedEnabled()
+                      && weight->params.zero_point == 0;
+
+      data->zero_bias = nullptr;
+      if (!data->use_mvp && !bias) {
+        data->zero_bias = static_cast<int32_t *>(context->AllocatePersistentBuffer(context, data->tile_rows * sizeof(int32_t)));
+        if (data->zero_bias == nullptr) {
+          return kTfLiteError;
+        }
+        memset(data->zero_bias, 0, data->tile_rows * sizeof(int32_t));
+      }
+    } else {
+      data->tile_rows = units;
+      sli_mvp_ml_fully_connected_s8_params_t chunk_params = data->op_params;
+      if (data->batches > data->batch_group) {
+        chunk_params.input_shape = shape2d(data->batch_group, depth);
+        chunk_params.output_shape = shape2d(data->batch_group, units);
+      }
+      data->use_mvp = kernel_backend::MvpEnabled()
+                      && sli_mvp_ml_fully_connected_s8_is_supported(&chunk_params);
+      data->batched = !data->use_mvp && data->batches > 1 && kernel_backend::SpecializedEnabled()
+                      && weight->params.zero_point == 0;
+    }
+
+    if (data->use_mvp && data->batch_group > 1 && data->tile_rows < units) {
+      TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, data->batch_group * data->tile_rows, &data->output_scratch_index));
+    }
 
     if (data->use_mvp && bias) {
       // Convert int32_t to float16_t as the MVP does not support loading int32 values.
@@ -126,13 +253,35 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       data->op_params.bias = bias_data;
     }
 
-    if (!data->use_mvp) {
+    if (!data->use_mvp || data->weights.format == compressed_weights::kWeightsBlockSparse) {
       // In this case we have to convert the output scale factor to a
       // value in the TensorFlow fixed point format (Q.31 + shift)
       int exponent;
       QuantizeMultiplier(real_multiplier, &data->output_multiplier, &exponent);
       data->output_shift = -exponent;
     }
+
+    data->unit_multiplier = nullptr;
+    data->unit_shift = nullptr;
+    if (data->batched) {
+      data->unit_multiplier = static_cast<int32_t *>(context->AllocatePersistentBuffer(context, data->tile_rows * sizeof(int32_t)));
+      data->unit_shift = static_cast<int32_t *>(context->AllocatePersistentBuffer(context, data->tile_rows * sizeof(int32_t)));
+      if (data->unit_multiplier == nullptr || data->unit_shift == nullptr) {
+        return kTfLiteError;
+      }
+      for (int i = 0; i < data->tile_rows; i++) {
+        data->unit_multiplier[i] = data->output_multiplier;
+        data->unit_shift[i] = -data->output_shift;
+      }
+    }
+
+    if (data->use_mvp) {
+      kernel_backend::Report(kernel_backend::kMvp);
+    } else {
+      kernel_backend::Report(data->batched ? kernel_backend::kCmsisNNBatched : kernel_backend::kCmsisNN);
+    }
+  } else {
+    kernel_backend::Report(kernel_backend::kReference);
   }
 
   micro_context->DeallocateTempTfLiteTensor(input);
@@ -155,6 +304,24 @@ TfLiteStatus EvalQuantizedInt8_MVP(TfLiteContext* context, TfLiteNode* node,
   params->input  = tflite::micro::GetTensorData<int8_t>(input);
   params->output = tflite::micro::GetTensorData<int8_t>(output);
 
+  if (data.batches > data.batch_group) {
+    // The MVP computes at most batch_group batches per call.
+    const int units = params->weight_shape.dim[0];
+    const int depth = params->weight_shape.dim[1];
+    for (int b = 0; b < data.batches; b += data.batch_group) {
+      const int n = std::min(data.batch_group, data.batches - b);
+      sli_mvp_ml_fully_connected_s8_params_t chunk_params = *params;
+      chunk_params.input = params->input + b * depth;
+      chunk_params.input_shape = shape2d(n, depth);
+      chunk_params.output = params->output + b * units;
+      chunk_params.output_shape = shape2d(n, units);
+      if (sli_mvp_ml_fully_connected_s8(&chunk_params) != SL_STATUS_OK) {
+        return kTfLiteError;
+      }
+    }
+    return kTfLiteOk;
+  }
+
   sl_status_t result = sli_mvp_ml_fully_connected_s8(params);
   if (result == SL_STATUS_OK) {
     return kTfLiteOk;
@@ -163,16 +330,252 @@ TfLiteStatus EvalQuantizedInt8_MVP(TfLiteContext* context, TfLiteNode* node,
   }
 }
 
+// Compute rows units, starting at unit row, of n batches in one MVP call.
+// The output rows are units apart, when they are not contiguous the MVP
+// writes them to the output scratch buffer first.
+TfLiteStatus EvalBatchedMvp(TfLiteContext* context, const OpData& data,
+                            const int8_t *input, int n,
+                            const int8_t *weights, int row, int rows, int depth,
+                            int8_t *output, int units) {
+  const bool contiguous = n == 1 || rows == units;
+  int8_t *out = output;
+  if (!contiguous) {
+    out = static_cast<int8_t*>(context->GetScratchBuffer(context, data.output_scratch_index));
+    TF_LITE_ENSURE(context, out != nullptr);
+  }
+
+  sli_mvp_ml_fully_connected_s8_params_t params = data.op_params;
+  params.input = input;
+  params.input_shape = shape2d(n, depth);
+  params.weight = weights;
+  params.weight_shape = shape2d(rows, depth);
+  params.bias = data.op_params.bias ? data.op_params.bias + row : nullptr;
+  params.bias_length = data.op_params.bias ? rows : 0;
+  params.output = out;
+  params.output_shape = shape2d(n, rows);
+  if (sli_mvp_ml_fully_connected_s8(&params) != SL_STATUS_OK) {
+    return kTfLiteError;
+  }
+
+  if (!contiguous) {
+    for (int b = 0; b < n; b++) {
+      memcpy(output + b * units, out + b * rows, rows);
+    }
+  }
+  return kTfLiteOk;
+}
+
+// Compute rows units of n batches on the CPU. The matrix multiplication reads
+// every weight row once for two batches, the input rows are input_stride
+// apart and the output rows units apart. The weight offset must be zero.
+TfLiteStatus EvalBatchedCmsis(TfLiteContext* context, const OpData& data,
+                              const int8_t *input, int input_stride, int n,
+                              const int8_t *weights, int rows, int depth,
+                              const int32_t *bias, int8_t *output, int units) {
+  TF_LITE_ENSURE_EQ(context, ARM_CMSIS_NN_SUCCESS,
+                    arm_nn_mat_mult_nt_t_s8(
+                      input, weights, bias, output,
+                      data.unit_multiplier, data.unit_shift,
+                      n, rows, depth,
+                      data.op_params.input_offset, data.op_params.output_offset,
+                      data.op_params.activation_min, data.op_params.activation_max,
+                      units, input_stride));
+  return kTfLiteOk;
+}
+
+TfLiteStatus EvalQuantizedInt8_Tiled(TfLiteContext* context, TfLiteNode* node,
+                                     const OpData& data,
+                                     const TfLiteEvalTensor* input,
+                                     const TfLiteEvalTensor* filter,
+                                     const TfLiteEvalTensor* bias,
+                                     TfLiteEvalTensor* output) {
+  const TfLiteIntArray *filter_dims = data.weights.dims;
+  const int batches = data.batches;
+  const int units = filter_dims->data[0];
+  const int depth = filter_dims->data[filter_dims->size - 1];
+
+  const int8_t *input_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int32_t *bias_data = tflite::micro::GetTensorData<int32_t>(bias);
+  int8_t *output_data = tflite::micro::GetTensorData<int8_t>(output);
+  int8_t *tile = static_cast<int8_t*>(context->GetScratchBuffer(context, data.tile_scratch_index));
+  TF_LITE_ENSURE(context, tile != nullptr);
+
+  cmsis_nn_fc_params fc_params;
+  fc_params.input_offset = data.op_params.input_offset;
+  fc_params.output_offset = data.op_params.output_offset;
+  fc_params.filter_offset = data.op_params.weight_offset;
+  fc_params.activation.min = data.op_params.activation_min;
+  fc_params.activation.max = data.op_params.activation_max;
+
+  cmsis_nn_per_tensor_quant_params quant_params;
+  quant_params.multiplier = data.output_multiplier;
+  quant_params.shift = -data.output_shift;
+
+  cmsis_nn_context ctx;
+  ctx.buf = nullptr;
+  ctx.size = 0;
+
+  for (int row = 0; row < units; row += data.tile_rows) {
+    const int rows = std::min(data.tile_rows, units - row);
+    compressed_weights::Decompress(data.weights, row * depth, rows * depth, tile);
+
+    // The tile is decompressed once and applied to all batches.
+    for (int b = 0; b < batches; b += data.batch_group) {
+      const int n = std::min(data.batch_group, batches - b);
+      const int8_t *in = input_data + b * depth;
+      int8_t *out = output_data + b * units + row;
+
+      if (data.use_mvp) {
+        TF_LITE_ENSURE_STATUS(EvalBatchedMvp(context, data, in, n, tile, row, rows, depth, out, units));
+      } else if (data.batched) {
+        TF_LITE_ENSURE_STATUS(EvalBatchedCmsis(context, data, in, depth, n, tile, rows, depth,
+                                               bias_data ? bias_data + row : nullptr, out, units));
+      } else {
+        const cmsis_nn_dims input_dims = { 1, 1, 1, depth };
+        const cmsis_nn_dims filter_dims = { depth, 1, 1, rows };
+        const cmsis_nn_dims bias_dims = { 1, 1, 1, rows };
+        const cmsis_nn_dims output_dims = { 1, 1, 1, rows };
+        for (int i = 0; i < n; i++) {
+          TF_LITE_ENSURE_EQ(
+              context,
+              arm_fully_connected_s8(
+                  &ctx, &fc_params, &quant_params, &input_dims, in + i * depth,
+                  &filter_dims, tile, &bias_dims,
+                  bias_data ? bias_data + row : data.zero_bias,
+                  &output_dims, out + i * units),
+              ARM_CMSIS_NN_SUCCESS);
+        }
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus EvalQuantizedInt8_BlockSparse(TfLiteContext* context, TfLiteNode* node,
+                                           const OpData& data,
+                                           const TfLiteEvalTensor* input,
+                                           const TfLiteEvalTensor* filter,
+                                           const TfLiteEvalTensor* bias,
+                                           TfLiteEvalTensor* output) {
+  const compressed_weights::Weights& w = data.weights;
+  const int batches = data.batches;
+  const int units = w.dims->data[0];
+  const int depth = w.dims->data[w.dims->size - 1];
+  const int row_blocks = units / w.block_rows;
+
+  const int8_t *input_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int32_t *bias_data = tflite::micro::GetTensorData<int32_t>(bias);
+  int8_t *output_data = tflite::micro::GetTensorData<int8_t>(output);
+  int8_t *gathered = static_cast<int8_t*>(context->GetScratchBuffer(context, data.tile_scratch_index));
+  TF_LITE_ENSURE(context, gathered != nullptr);
+
+  cmsis_nn_fc_params fc_params;
+  fc_params.input_offset = data.op_params.input_offset;
+  fc_params.output_offset = data.op_params.output_offset;
+  fc_params.filter_offset = data.op_params.weight_offset;
+  fc_params.activation.min = data.op_params.activation_min;
+  fc_params.activation.max = data.op_params.activation_max;
+
+  cmsis_nn_per_tensor_quant_params quant_params;
+  quant_params.multiplier = data.output_multiplier;
+  quant_params.shift = -data.output_shift;
+
+  cmsis_nn_context ctx;
+  ctx.buf = nullptr;
+  ctx.size = 0;
+
+  // Every row of blocks is read once and applied to a group of batches, the
+  // input segments of the group are gathered next to each other.
+  const int8_t *block_weights = w.data;
+  for (int r = 0; r < row_blocks; r++) {
+    const int row = r * w.block_rows;
+    const int blocks = w.block_ptr[r + 1] - w.block_ptr[r];
+    const int block_depth = blocks * w.block_cols;
+
+    if (blocks == 0) {
+      // Only the bias contributes to these outputs.
+      for (int i = 0; i < w.block_rows; i++) {
+        int32_t acc = bias_data ? bias_data[row + i] : 0;
+        acc = MultiplyByQuantizedMultiplier(acc, data.output_multiplier, -data.output_shift);
+        acc += data.op_params.output_offset;
+        acc = std::max(acc, static_cast<int32_t>(data.op_params.activation_min));
+        acc = std::min(acc, static_cast<int32_t>(data.op_params.activation_max));
+        output_data[row + i] = static_cast<int8_t>(acc);
+      }
+      for (int b = 1; b < batches; b++) {
+        memcpy(output_data + b * units + row, output_data + row, w.block_rows);
+      }
+      continue;
+    }
+
+    // Gather the input segments matching the nonzero blocks. The zero
+    // blocks do not contribute to the result, with or without input offset.
+    const uint16_t *index = w.block_index + w.block_ptr[r];
+    const int group = (data.use_mvp || data.batched) ? data.batch_group : 1;
+    for (int b = 0; b < batches; b += group) {
+      const int n = std::min(group, batches - b);
+      for (int i = 0; i < n; i++) {
+        const int8_t *in = input_data + (b + i) * depth;
+        for (int j = 0; j < blocks; j++) {
+          memcpy(gathered + i * block_depth + j * w.block_cols, in + index[j] * w.block_cols, w.block_cols);
+        }
+      }
+      int8_t *out = output_data + b * units + row;
+
+      if (data.use_mvp) {
+        TF_LITE_ENSURE_STATUS(EvalBatchedMvp(context, data, gathered, n, block_weights,
+                                             row, w.block_rows, block_depth, out, units));
+      } else if (data.batched) {
+        TF_LITE_ENSURE_STATUS(EvalBatchedCmsis(context, data, gathered, block_depth, n,
+                                               block_weights, w.block_rows, block_depth,
+                                               bias_data ? bias_data + row : nullptr, out, units));
+      } else {
+        const cmsis_nn_dims input_dims = { 1, 1, 1, block_depth };
+        const cmsis_nn_dims filter_dims = { block_depth, 1, 1, w.block_rows };
+        const cmsis_nn_dims bias_dims = { 1, 1, 1, w.block_rows };
+        const cmsis_nn_dims output_dims = { 1, 1, 1, w.block_rows };
+        TF_LITE_ENSURE_EQ(
+            context,
+            arm_fully_connected_s8(
+                &ctx, &fc_params, &quant_params, &input_dims, gathered,
+                &filter_dims, block_weights, &bias_dims,
+                bias_data ? bias_data + row : data.zero_bias,
+                &output_dims, out),
+            ARM_CMSIS_NN_SUCCESS);
+      }
+    }
+    block_weights += w.block_rows * block_depth;
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus EvalQuantizedInt8(TfLiteContext* context, TfLiteNode* node,
                                const OpData& data,
                                const TfLiteEvalTensor* input,
                                const TfLiteEvalTensor* filter,
                                const TfLiteEvalTensor* bias,
                                TfLiteEvalTensor* output) {
+  if (data.weights.format == compressed_weights::kWeightsBlockSparse) {
+    return EvalQuantizedInt8_BlockSparse(context, node, data, input, filter, bias, output);
+  }
+  if (compressed_weights::IsCompressed(data.weights)) {
+    return EvalQuantizedInt8_Tiled(context, node, data, input, filter, bias, output);
+  }
+
   if (data.use_mvp && input->type == kTfLiteInt8) {
     return EvalQuantizedInt8_MVP(context, node, data, input, filter, bias, output);
   }
 
+  if (data.batched) {
+    const RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+    const int units = filter_shape.Dims(0);
+    const int depth = filter_shape.Dims(filter_shape.DimensionsCount() - 1);
+    return EvalBatchedCmsis(context, data, tflite::micro::GetTensorData<int8_t>(input), depth,
+                            data.batches, tflite::micro::GetTensorData<int8_t>(filter), units, depth,
+                            tflite::micro::GetTensorData<int32_t>(bias),
+                            tflite::micro::GetTensorData<int8_t>(output), units);
+  }
+
   // The 'if' condition can be removed when null handling of bias is added to
   // arm_fully_connected_s8
   if (nullptr != tflite::micro::GetTensorData<int32_t>(bias)) {
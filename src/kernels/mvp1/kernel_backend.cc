@@ -0,0 +1,65 @@
+
+#include "kernel_backend.h"
+
+namespace tflite {
+namespace sl {
+namespace kernel_backend {
+
+static bool mvp_enabled = true;
+static bool specialized_enabled = true;
+static backend last_selected = kReference;
+
+void SetMvpEnabled(bool enabled)
+{
+  mvp_enabled = enabled;
+}
+
+bool MvpEnabled()
+{
+  return mvp_enabled;
+}
+
+void SetSpecializedEnabled(bool enabled)
+{
+  specialized_enabled = enabled;
+}
+
+bool SpecializedEnabled()
+{
+  return specialized_enabled;
+}
+
+void Report(backend selected)
+{
+  last_selected = selected;
+}
+
+backend LastSelected()
+{
+  return last_selected;
+}
+
+const char* Name(backend selected)
+{
+  switch (selected) {
+    case kMvp:
+      return "mvp";
+    case kMvpPointwise:
+      return "mvp_pointwise";
+    case kCmsisNN:
+      return "cmsis_nn";
+    case kCmsisNNPointwise:
+      return "cmsis_nn_pointwise";
+    case kCmsisNNBatched:
+      return "cmsis_nn_batched";
+    case kCpuUnrolled:
+      return "cpu_unrolled";
+    case kReference:
+    default:
+      return "reference";
+  }
+}
+
+}  // namespace kernel_backend
+}  // namespace sl
+}  // namespace tflite
@@ -0,0 +1,40 @@
+
+#ifndef SL_MVP1_KERNEL_BACKEND_H
+#define SL_MVP1_KERNEL_BACKEND_H
+
+namespace tflite {
+namespace sl {
+namespace kernel_backend {
+
+// The pointwise backends compute 1x1 convolutions as a matrix multiplication,
+// kCmsisNNBatched computes several fully connected batches per weight row and
+// kCpuUnrolled are CPU kernels specialized for a filter size and stride, or
+// unrolled type conversions.
+enum backend { kMvp, kMvpPointwise, kCmsisNN, kCmsisNNPointwise, kCmsisNNBatched,
+               kCpuUnrolled, kReference };
+
+// Allow kernels prepared after this call to run on the MVP. Enabled by
+// default, disabling it forces the CPU implementations, e.g. to compare
+// backends.
+void SetMvpEnabled(bool enabled);
+bool MvpEnabled();
+
+// Allow kernels prepared after this call to select the CPU kernels
+// specialized for a filter size and stride, or for batched fully connected
+// layers, instead of the generic CMSIS-NN kernels. Enabled by default.
+void SetSpecializedEnabled(bool enabled);
+bool SpecializedEnabled();
+
+// Record the backend selected by a kernel in Prepare().
+void Report(backend selected);
+
+// Backend selected by the most recently prepared kernel.
+backend LastSelected();
+
+const char* Name(backend selected);
+
+}  // namespace kernel_backend
+}  // namespace sl
+}  // namespace tflite
+
+#endif  // SL_MVP1_KERNEL_BACKEND_H
@@ -13,6 +13,7 @@
 #include "tensorflow/lite/micro/micro_log.h"
 
 #include "sl_mvp_ml_mul.h"
+#include "kernel_backend.h"
 
 namespace tflite {
 namespace sl {
@@ -21,6 +22,7 @@ namespace mul {
 struct SlOpDataMul {
   tflite::OpDataMul opdata;
   sli_mvp_ml_mul_s8_params_t params;
+  bool use_mvp;
 };
 
 void* MulInit(TfLiteContext* context, const char* buffer, size_t length) {
@@ -31,6 +33,7 @@ void* MulInit(TfLiteContext* context, const char* buffer, size_t length) {
 TfLiteStatus CalculateMvpParams(TfLiteContext* context, TfLiteNode* node,
                                 TfLiteMulParams* params, SlOpDataMul* data) {
   memset(&data->params, 0, sizeof(sli_mvp_ml_mul_s8_params_t));
+  data->use_mvp = false;
 
   MicroContext* micro_context = GetMicroContext(context);
 
@@ -50,6 +53,16 @@ TfLiteStatus CalculateMvpParams(TfLiteContext* context, TfLiteNode* node,
     data->params.output_multiplier = static_cast<float>(real_multiplier);
     data->params.activation_min = static_cast<int8_t>(data->opdata.output_activation_min);
     data->params.activation_max = static_cast<int8_t>(data->opdata.output_activation_max);
+    data->use_mvp = kernel_backend::MvpEnabled();
+  }
+
+  if (!HaveSameShapes(input1, input2) || output->type == kTfLiteInt32
+      || output->type == kTfLiteFloat32) {
+    kernel_backend::Report(kernel_backend::kReference);
+  } else if (output->type == kTfLiteInt8 && data->use_mvp) {
+    kernel_backend::Report(kernel_backend::kMvp);
+  } else {
+    kernel_backend::Report(kernel_backend::kCmsisNN);
   }
 
   micro_context->DeallocateTempTfLiteTensor(input1);
@@ -111,7 +124,7 @@ TfLiteStatus EvalQuantized(TfLiteContext* context, TfLiteNode* node,
     }
 
   } else {
-    if (input1->type == kTfLiteInt8) {
+    if (input1->type == kTfLiteInt8 && sldata->use_mvp) {
       sli_mvp_ml_mul_s8_params_t params = sldata->params;
       params.input1 = tflite::micro::GetTensorData<int8_t>(input1);
       params.input2 = tflite::micro::GetTensorData<int8_t>(input2);
@@ -120,6 +133,18 @@ TfLiteStatus EvalQuantized(TfLiteContext* context, TfLiteNode* node,
                                tflite::micro::GetTensorShape(input2),
                                tflite::micro::GetTensorShape(output));
       status = sli_mvp_ml_mul_s8(&params);
+    } else if (input1->type == kTfLiteInt8) {
+      arm_elementwise_mul_s8(
+          tflite::micro::GetTensorData<int8_t>(input1),
+          tflite::micro::GetTensorData<int8_t>(input2),
+          op_params.input1_offset, op_params.input2_offset,
+          tflite::micro::GetTensorData<int8_t>(output),
+          op_params.output_offset, op_params.output_multiplier,
+          op_params.output_shift, op_params.quantized_activation_min,
+          op_params.quantized_activation_max,
+          MatchingElementsSize(tflite::micro::GetTensorShape(input1),
+                               tflite::micro::GetTensorShape(input2),
+                               tflite::micro::GetTensorShape(output)));
     } else if (input1->type == kTfLiteInt16) {
       arm_elementwise_mul_s16(
           tflite::micro::GetTensorData<int16_t>(input1),
@@ -8,6 +8,7 @@
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 
 #include "sl_mvp_ml_pooling.h"
+#include "kernel_backend.h"
 
 namespace tflite {
 namespace sl {
@@ -28,6 +29,13 @@ struct OpData {
   int buffer_idx;
 };
 
+void ReportBackend(const OpData* data)
+{
+  kernel_backend::Report(data->supported == kMvp     ? kernel_backend::kMvp
+                         : data->supported == kCmsisNN ? kernel_backend::kCmsisNN
+                         : kernel_backend::kReference);
+}
+
 }  // namespace
 
 void* Init(TfLiteContext* context, const char* buffer, size_t length)
@@ -116,7 +124,8 @@ TfLiteStatus AveragePrepare(TfLiteContext* context, TfLiteNode* node)
 
   if (status == kTfLiteOk) {
     if (input->type == kTfLiteInt8) {
-      data->supported = sli_mvp_ml_average_pooling_s8_is_supported(&data->op_params)
+      data->supported = kernel_backend::MvpEnabled()
+                        && sli_mvp_ml_average_pooling_s8_is_supported(&data->op_params)
                         ? kMvp : kCmsisNN;
       if (data->supported == kCmsisNN) {
         const int32_t buffer_size = arm_avgpool_s8_get_buffer_size(
@@ -131,6 +140,7 @@ TfLiteStatus AveragePrepare(TfLiteContext* context, TfLiteNode* node)
         }
       }
     }
+    ReportBackend(data);
   }
 
   micro_context->DeallocateTempTfLiteTensor(input);
@@ -158,9 +168,11 @@ TfLiteStatus MaxPrepare(TfLiteContext* context, TfLiteNode* node)
 
   if (status == kTfLiteOk) {
     if (input->type == kTfLiteInt8) {
-      data->supported = sli_mvp_ml_max_pooling_s8_is_supported(&data->op_params)
+      data->supported = kernel_backend::MvpEnabled()
+                        && sli_mvp_ml_max_pooling_s8_is_supported(&data->op_params)
                         ? kMvp : kCmsisNN;
     }
+    ReportBackend(data);
   }
 
   micro_context->DeallocateTempTfLiteTensor(input);
@@ -0,0 +1,131 @@
+
+#include "tensorflow/lite/micro/kernels/quantize.h"
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+#include "kernel_backend.h"
+#include "type_conversion.h"
+
+namespace tflite {
+namespace sl {
+namespace quantize {
+
+// The reference Prepare and Eval take the user data as
+// OpDataQuantizeReference, it must stay the first member.
+struct OpData {
+  OpDataQuantizeReference reference;
+  bool use_unrolled;
+  float inv_scale;
+  type_conversion::RequantizeParams requantize;
+};
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(PrepareQuantizeReference(context, node));
+
+  TFLITE_DCHECK(node->user_data != nullptr);
+  OpData* data = static_cast<OpData*>(node->user_data);
+
+  MicroContext* micro_context = GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, 0);
+  TF_LITE_ENSURE(context, input != nullptr);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, 0);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  // Float to int8 and int16, and requantization between int8 and int16,
+  // have unrolled implementations. The remaining combinations use the
+  // reference kernel.
+  const bool quantized_output = output->type == kTfLiteInt8 || output->type == kTfLiteInt16;
+  const bool supported_input = input->type == kTfLiteFloat32
+                               || input->type == kTfLiteInt8
+                               || input->type == kTfLiteInt16;
+  data->use_unrolled = kernel_backend::SpecializedEnabled() && quantized_output && supported_input;
+
+  if (data->use_unrolled) {
+    data->inv_scale = 1.0f / static_cast<float>(data->reference.quantization_params.scale);
+    data->requantize.input_offset = -data->reference.input_zero_point;
+    data->requantize.multiplier = data->reference.requantize_output_multiplier;
+    data->requantize.shift = data->reference.requantize_output_shift;
+    data->requantize.output_offset = data->reference.quantization_params.zero_point;
+  }
+  kernel_backend::Report(data->use_unrolled ? kernel_backend::kCpuUnrolled
+                                            : kernel_backend::kReference);
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const OpData& data = *static_cast<const OpData*>(node->user_data);
+
+  if (!data.use_unrolled) {
+    return EvalQuantizeReference(context, node);
+  }
+
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, 0);
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, 0);
+  const int size = MatchingFlatSize(tflite::micro::GetTensorShape(input),
+                                    tflite::micro::GetTensorShape(output));
+  const int32_t zero_point = data.reference.quantization_params.zero_point;
+
+  switch (input->type) {
+    case kTfLiteFloat32:
+      if (output->type == kTfLiteInt8) {
+        type_conversion::Quantize(tflite::micro::GetTensorData<float>(input),
+                                  tflite::micro::GetTensorData<int8_t>(output),
+                                  size, data.inv_scale, zero_point);
+      } else {
+        type_conversion::Quantize(tflite::micro::GetTensorData<float>(input),
+                                  tflite::micro::GetTensorData<int16_t>(output),
+                                  size, data.inv_scale, zero_point);
+      }
+      break;
+    case kTfLiteInt8:
+      if (output->type == kTfLiteInt8) {
+        type_conversion::Requantize(data.requantize,
+                                    tflite::micro::GetTensorData<int8_t>(input),
+                                    tflite::micro::GetTensorData<int8_t>(output), size);
+      } else {
+        type_conversion::Requantize(data.requantize,
+                                    tflite::micro::GetTensorData<int8_t>(input),
+                                    tflite::micro::GetTensorData<int16_t>(output), size);
+      }
+      break;
+    case kTfLiteInt16:
+      if (output->type == kTfLiteInt8) {
+        type_conversion::Requantize(data.requantize,
+                                    tflite::micro::GetTensorData<int16_t>(input),
+                                    tflite::micro::GetTensorData<int8_t>(output), size);
+      } else {
+        type_conversion::Requantize(data.requantize,
+                                    tflite::micro::GetTensorData<int16_t>(input),
+                                    tflite::micro::GetTensorData<int16_t>(output), size);
+      }
+      break;
+    default:
+      MicroPrintf("Input %s, output %s not supported.",
+                  TfLiteTypeGetName(input->type),
+                  TfLiteTypeGetName(output->type));
+      return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace quantize
+}  // namespace sl
+
+TFLMRegistration Register_QUANTIZE() {
+  return tflite::micro::RegisterOp(sl::quantize::Init, sl::quantize::Prepare, sl::quantize::Eval);
+}
+
+}  // namespace tflite
@@ -0,0 +1,160 @@
+
+#include "streaming_conv.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+
+#include "sl_tflite_micro_config.h"
+#include "sl_tflite_micro_streaming.h"
+
+namespace tflite {
+namespace sl {
+namespace streaming_conv {
+
+TfLiteStatus Prepare(TfLiteContext* context, State* state, int input_index,
+                     const TfLiteTensor* input, const TfLiteTensor* output,
+                     int stride, int dilation, int filter_rows, int pad_top)
+{
+  state->enabled     = false;
+  state->valid       = false;
+  state->model_input = false;
+
+#if defined(SL_TFLITE_MICRO_STREAMING_ENABLE) && (SL_TFLITE_MICRO_STREAMING_ENABLE == 1)
+  if (input->type != kTfLiteInt8 || input->dims->size != 4 || input->dims->data[0] != 1) {
+    return kTfLiteOk;
+  }
+
+  state->input_rows      = input->dims->data[1];
+  state->input_row_size  = input->dims->data[2] * input->dims->data[3];
+  state->output_rows     = output->dims->data[1];
+  state->output_row_size = output->dims->data[2] * output->dims->data[3];
+  state->stride          = stride;
+  state->dilation        = dilation;
+  state->filter_rows     = filter_rows;
+  state->pad_top         = pad_top;
+
+  // Output row r reads the input rows r * stride - pad_top up to
+  // r * stride - pad_top + (filter_rows - 1) * dilation.
+  state->top_rows = (pad_top + stride - 1) / stride;
+  const int remaining = state->input_rows + pad_top - (filter_rows - 1) * dilation;
+  state->bottom_row = remaining <= 0 ? 0 : (remaining + stride - 1) / stride;
+  state->bottom_row = std::min(state->bottom_row, state->output_rows);
+
+  state->cache = static_cast<int8_t*>(context->AllocatePersistentBuffer(
+                   context, state->output_rows * state->output_row_size));
+  TF_LITE_ENSURE(context, state->cache != nullptr);
+  state->head        = 0;
+  state->model_input = sli_tflite_micro_streaming_is_input(input_index);
+  state->enabled     = true;
+#else
+  (void)context;
+  (void)input_index;
+  (void)input;
+  (void)output;
+  (void)stride;
+  (void)dilation;
+  (void)filter_rows;
+  (void)pad_top;
+#endif
+
+  return kTfLiteOk;
+}
+
+int Begin(State* state, const TfLiteEvalTensor* input, TfLiteEvalTensor* output,
+          int* reuse_begin, int* reuse_end)
+{
+  *reuse_begin = 0;
+  *reuse_end   = 0;
+  if (!state->enabled || !state->valid) {
+    return -1;
+  }
+
+  // The input is either the registered model input updated by the
+  // application, or is produced by another streaming layer.
+  int input_shift;
+  if (state->model_input) {
+    input_shift = sli_tflite_micro_streaming_get_input_shift(
+                    state->input_row_size, state->input_rows, state->sequence);
+  } else if (!sli_tflite_micro_streaming_get_tensor_shift(input, &input_shift)) {
+    return -1;
+  }
+  if (input_shift < 0 || input_shift % state->stride != 0) {
+    return -1;
+  }
+
+  const int shift = input_shift / state->stride;
+  if (shift == 0) {
+    *reuse_begin = 0;
+    *reuse_end   = state->output_rows;
+  } else {
+    *reuse_begin = state->top_rows;
+    *reuse_end   = state->bottom_row - shift;
+    if (*reuse_begin >= *reuse_end) {
+      *reuse_begin = 0;
+      *reuse_end   = 0;
+      return -1;
+    }
+  }
+
+  int8_t *out = tflite::micro::GetTensorData<int8_t>(output);
+  for (int row = *reuse_begin; row < *reuse_end; row++) {
+    const int index = (state->head + row + shift) % state->output_rows;
+    memcpy(out + row * state->output_row_size,
+           state->cache + index * state->output_row_size,
+           state->output_row_size);
+  }
+
+  return shift;
+}
+
+void End(State* state, const TfLiteEvalTensor* output, int shift,
+         int reuse_begin, int reuse_end)
+{
+  if (!state->enabled) {
+    return;
+  }
+
+  if (shift < 0) {
+    state->head = 0;
+    reuse_begin = 0;
+    reuse_end   = 0;
+  } else {
+    state->head = (state->head + shift) % state->output_rows;
+  }
+
+  const int8_t *out = tflite::micro::GetTensorData<int8_t>(output);
+  for (int row = 0; row < state->output_rows; row++) {
+    if (row >= reuse_begin && row < reuse_end) {
+      continue;
+    }
+    const int index = (state->head + row) % state->output_rows;
+    memcpy(state->cache + index * state->output_row_size,
+           out + row * state->output_row_size,
+           state->output_row_size);
+  }
+
+  state->valid    = true;
+  state->sequence = sli_tflite_micro_streaming_get_sequence();
+  sli_tflite_micro_streaming_set_tensor_shift(output, shift);
+}
+
+RowBand Band(const State* state, int row_begin, int row_end)
+{
+  const int first = row_begin * state->stride - state->pad_top;
+  const int last  = (row_end - 1) * state->stride - state->pad_top
+                    + (state->filter_rows - 1) * state->dilation;
+
+  RowBand band;
+  band.output_row  = row_begin;
+  band.output_rows = row_end - row_begin;
+  band.pad_top     = first < 0 ? -first : 0;
+  band.input_row   = std::max(first, 0);
+  band.input_rows  = std::min(last + 1, state->input_rows) - band.input_row;
+  return band;
+}
+
+}  // namespace streaming_conv
+}  // namespace sl
+}  // namespace tflite
@@ -0,0 +1,73 @@
+
+#ifndef SL_MVP1_STREAMING_CONV_H
+#define SL_MVP1_STREAMING_CONV_H
+
+#include "tensorflow/lite/c/common.h"
+
+namespace tflite {
+namespace sl {
+namespace streaming_conv {
+
+// Output row cache of a convolution running on a sliding window input.
+// The cache is a ring of output rows, logical row 0 is stored at index head.
+struct State {
+  bool     enabled;
+  bool     valid;
+  bool     model_input;
+  uint32_t sequence;
+  int8_t   *cache;
+  int      head;
+
+  // Geometry along the time axis (dimension 1).
+  int      input_rows;
+  int      input_row_size;
+  int      output_rows;
+  int      output_row_size;
+  int      stride;
+  int      dilation;
+  int      filter_rows;
+  int      pad_top;
+
+  // Output rows [top_rows, bottom_row) do not read any padding and can be
+  // reused after a shift of the input.
+  int      top_rows;
+  int      bottom_row;
+};
+
+// A range of output rows together with the input rows it reads.
+struct RowBand {
+  int output_row;
+  int output_rows;
+  int input_row;
+  int input_rows;
+  int pad_top;
+};
+
+// Allocate the output row cache. Streaming is only enabled for int8
+// convolutions with a batch size of 1, other layers are left untouched.
+// input_index is the tensor index of the input, it is compared against the
+// model input registered with sl_tflite_micro_streaming_register_input().
+TfLiteStatus Prepare(TfLiteContext* context, State* state, int input_index,
+                     const TfLiteTensor* input, const TfLiteTensor* output,
+                     int stride, int dilation, int filter_rows, int pad_top);
+
+// Restore the output rows that are unchanged since the previous invocation
+// from the cache. The rows in [*reuse_begin, *reuse_end) are filled in,
+// all other rows must be computed by the kernel. Returns the output shift in
+// rows, or -1 if the whole output must be computed.
+int Begin(State* state, const TfLiteEvalTensor* input, TfLiteEvalTensor* output,
+          int* reuse_begin, int* reuse_end);
+
+// Store the computed output rows in the cache and publish the output shift
+// to the layers consuming this output.
+void End(State* state, const TfLiteEvalTensor* output, int shift,
+         int reuse_begin, int reuse_end);
+
+// Input window of the output rows [row_begin, row_end).
+RowBand Band(const State* state, int row_begin, int row_end);
+
+}  // namespace streaming_conv
+}  // namespace sl
+}  // namespace tflite
+
+#endif  // SL_MVP1_STREAMING_CONV_H
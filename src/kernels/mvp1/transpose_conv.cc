@@ -11,6 +11,7 @@ using int32 = int32_t;
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 
 #include "sl_mvp_ml_transpose_conv2d.h"
+#include "kernel_backend.h"
 
 namespace tflite {
 namespace sl {
@@ -156,7 +157,8 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
   const int num_channels = data->op_params.out_channels;
 
   if (input->type == kTfLiteInt8) {
-    if (sli_mvp_ml_transpose_conv2d_s8_is_supported(&data->op_params)) {
+    if (kernel_backend::MvpEnabled()
+        && sli_mvp_ml_transpose_conv2d_s8_is_supported(&data->op_params)) {
       data->supported = kMvp;
       scratch_buffer_size = GetTensorShape(output).FlatSize() * sizeof(float16_t);
 
@@ -213,6 +215,9 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
     return kTfLiteError;
   }
 
+  kernel_backend::Report(data->supported == kMvp ? kernel_backend::kMvp
+                                                : kernel_backend::kReference);
+
   if(scratch_buffer_size > 0) {
     TF_LITE_ENSURE_STATUS(
       context->RequestScratchBufferInArena(
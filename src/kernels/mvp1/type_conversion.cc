@@ -0,0 +1,145 @@
+
+#include "type_conversion.h"
+
+#include <limits>
+
+#include "Include/arm_nnsupportfunctions.h"
+
+namespace tflite {
+namespace sl {
+namespace type_conversion {
+
+namespace {
+
+// The scaled value is clamped before the conversion to integer, the clamp
+// range is shifted by the zero point so that it is applied before rounding.
+template <typename T>
+inline T quantize_value(float value, float inv_scale, float min, float max, int32_t zero_point)
+{
+  float scaled = value * inv_scale;
+  scaled = scaled < min ? min : scaled;
+  scaled = scaled > max ? max : scaled;
+  // Round half away from zero, like TfLiteRound().
+  const int32_t rounded = static_cast<int32_t>(scaled + (scaled >= 0.0f ? 0.5f : -0.5f));
+  return static_cast<T>(rounded + zero_point);
+}
+
+template <typename T>
+void quantize(const float* input, T* output, int size, float inv_scale, int32_t zero_point)
+{
+  const float min = static_cast<float>(std::numeric_limits<T>::min() - zero_point);
+  const float max = static_cast<float>(std::numeric_limits<T>::max() - zero_point);
+
+  int i = 0;
+  for (; i <= size - 4; i += 4) {
+    const T q0 = quantize_value<T>(input[i + 0], inv_scale, min, max, zero_point);
+    const T q1 = quantize_value<T>(input[i + 1], inv_scale, min, max, zero_point);
+    const T q2 = quantize_value<T>(input[i + 2], inv_scale, min, max, zero_point);
+    const T q3 = quantize_value<T>(input[i + 3], inv_scale, min, max, zero_point);
+    output[i + 0] = q0;
+    output[i + 1] = q1;
+    output[i + 2] = q2;
+    output[i + 3] = q3;
+  }
+  for (; i < size; i++) {
+    output[i] = quantize_value<T>(input[i], inv_scale, min, max, zero_point);
+  }
+}
+
+template <typename T>
+void dequantize(const T* input, float* output, int size, float scale, int32_t zero_point)
+{
+  int i = 0;
+  for (; i <= size - 4; i += 4) {
+    const int32_t v0 = input[i + 0] - zero_point;
+    const int32_t v1 = input[i + 1] - zero_point;
+    const int32_t v2 = input[i + 2] - zero_point;
+    const int32_t v3 = input[i + 3] - zero_point;
+    output[i + 0] = static_cast<float>(v0) * scale;
+    output[i + 1] = static_cast<float>(v1) * scale;
+    output[i + 2] = static_cast<float>(v2) * scale;
+    output[i + 3] = static_cast<float>(v3) * scale;
+  }
+  for (; i < size; i++) {
+    output[i] = static_cast<float>(input[i] - zero_point) * scale;
+  }
+}
+
+template <typename TIn, typename TOut>
+inline TOut requantize_value(const RequantizeParams& p, TIn value)
+{
+  int32_t acc = arm_nn_requantize(value + p.input_offset, p.multiplier, p.shift);
+  acc += p.output_offset;
+  acc = acc < std::numeric_limits<TOut>::min() ? std::numeric_limits<TOut>::min() : acc;
+  acc = acc > std::numeric_limits<TOut>::max() ? std::numeric_limits<TOut>::max() : acc;
+  return static_cast<TOut>(acc);
+}
+
+template <typename TIn, typename TOut>
+void requantize(const RequantizeParams& p, const TIn* input, TOut* output, int size)
+{
+  int i = 0;
+  for (; i <= size - 4; i += 4) {
+    const TOut q0 = requantize_value<TIn, TOut>(p, input[i + 0]);
+    const TOut q1 = requantize_value<TIn, TOut>(p, input[i + 1]);
+    const TOut q2 = requantize_value<TIn, TOut>(p, input[i + 2]);
+    const TOut q3 = requantize_value<TIn, TOut>(p, input[i + 3]);
+    output[i + 0] = q0;
+    output[i + 1] = q1;
+    output[i + 2] = q2;
+    output[i + 3] = q3;
+  }
+  for (; i < size; i++) {
+    output[i] = requantize_value<TIn, TOut>(p, input[i]);
+  }
+}
+
+}  // namespace
+
+void Quantize(const float* input, int8_t* output, int size,
+              float inv_scale, int32_t zero_point)
+{
+  quantize(input, output, size, inv_scale, zero_point);
+}
+
+void Quantize(const float* input, int16_t* output, int size,
+              float inv_scale, int32_t zero_point)
+{
+  quantize(input, output, size, inv_scale, zero_point);
+}
+
+void Dequantize(const int8_t* input, float* output, int size,
+                float scale, int32_t zero_point)
+{
+  dequantize(input, output, size, scale, zero_point);
+}
+
+void Dequantize(const int16_t* input, float* output, int size,
+                float scale, int32_t zero_point)
+{
+  dequantize(input, output, size, scale, zero_point);
+}
+
+void Requantize(const RequantizeParams& params, const int8_t* input, int8_t* output, int size)
+{
+  requantize(params, input, output, size);
+}
+
+void Requantize(const RequantizeParams& params, const int8_t* input, int16_t* output, int size)
+{
+  requantize(params, input, output, size);
+}
+
+void Requantize(const RequantizeParams& params, const int16_t* input, int8_t* output, int size)
+{
+  requantize(params, input, output, size);
+}
+
+void Requantize(const RequantizeParams& params, const int16_t* input, int16_t* output, int size)
+{
+  requantize(params, input, output, size);
+}
+
+}  // namespace type_conversion
+}  // namespace sl
+}  // namespace tflite
@@ -0,0 +1,57 @@
+
+#ifndef SL_MVP1_TYPE_CONVERSION_H
+#define SL_MVP1_TYPE_CONVERSION_H
+
+#include <cstdint>
+
+namespace tflite {
+namespace sl {
+namespace type_conversion {
+
+// Conversions between float and per tensor quantized int8 and int16 values,
+// and between quantization parameters. The loops process four values per
+// iteration.
+//
+// Quantize multiplies by the reciprocal of the scale instead of dividing by
+// the scale in double precision like the reference kernel. It is not bit-exact
+// with the reference, values within the rounding error of half a step can be
+// one step off.
+//
+// Dequantize is bit-exact with the reference kernel. The reference computes
+// the product in double precision and converts it to float. The product of a
+// 17 bit integer and a float scale is exact in double precision, so that
+// conversion is the only rounding, the same as of the float product.
+
+// output = round(input * inv_scale) + zero_point, saturated to the output type.
+void Quantize(const float* input, int8_t* output, int size,
+              float inv_scale, int32_t zero_point);
+void Quantize(const float* input, int16_t* output, int size,
+              float inv_scale, int32_t zero_point);
+
+// output = (input - zero_point) * scale, where scale must be the float
+// scale of the input tensor.
+void Dequantize(const int8_t* input, float* output, int size,
+                float scale, int32_t zero_point);
+void Dequantize(const int16_t* input, float* output, int size,
+                float scale, int32_t zero_point);
+
+// CMSIS-NN fixed point multiplier and shift, and offsets of a requantization.
+struct RequantizeParams {
+  int32_t input_offset;
+  int32_t multiplier;
+  int32_t shift;
+  int32_t output_offset;
+};
+
+// output = (input + input_offset) * multiplier + output_offset, saturated to
+// the output type.
+void Requantize(const RequantizeParams& params, const int8_t* input, int8_t* output, int size);
+void Requantize(const RequantizeParams& params, const int8_t* input, int16_t* output, int size);
+void Requantize(const RequantizeParams& params, const int16_t* input, int8_t* output, int size);
+void Requantize(const RequantizeParams& params, const int16_t* input, int16_t* output, int size);
+
+}  // namespace type_conversion
+}  // namespace sl
+}  // namespace tflite
+
+#endif  // SL_MVP1_TYPE_CONVERSION_H
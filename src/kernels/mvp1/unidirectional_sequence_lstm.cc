@@ -0,0 +1,655 @@
+
+#include <cmath>
+#include <cstring>
+
+#include "Include/arm_nnfunctions.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+
+#include "sl_mvp_ml_fully_connected.h"
+#include "kernel_backend.h"
+
+namespace tflite {
+namespace sl {
+namespace unidirectional_sequence_lstm {
+
+constexpr int kInputTensor = 0;
+constexpr int kInputToInputWeightsTensor = 1;  // Optional (CIFG)
+constexpr int kInputToForgetWeightsTensor = 2;
+constexpr int kInputToCellWeightsTensor = 3;
+constexpr int kInputToOutputWeightsTensor = 4;
+constexpr int kRecurrentToInputWeightsTensor = 5;  // Optional (CIFG)
+constexpr int kRecurrentToForgetWeightsTensor = 6;
+constexpr int kRecurrentToCellWeightsTensor = 7;
+constexpr int kRecurrentToOutputWeightsTensor = 8;
+constexpr int kCellToInputWeightsTensor = 9;    // Optional (peephole)
+constexpr int kCellToForgetWeightsTensor = 10;  // Optional (peephole)
+constexpr int kCellToOutputWeightsTensor = 11;  // Optional (peephole)
+constexpr int kInputGateBiasTensor = 12;        // Optional (CIFG)
+constexpr int kForgetGateBiasTensor = 13;
+constexpr int kCellGateBiasTensor = 14;
+constexpr int kOutputGateBiasTensor = 15;
+constexpr int kProjectionWeightsTensor = 16;  // Optional
+constexpr int kProjectionBiasTensor = 17;     // Optional
+constexpr int kOutputStateTensor = 18;
+constexpr int kCellStateTensor = 19;
+constexpr int kInputLayerNormCoefficientsTensor = 20;  // Optional
+constexpr int kOutputTensor = 0;
+
+// Gate order used for all per-gate arrays below.
+enum gate { kInputGate, kForgetGate, kCellGate, kOutputGate, kNumGates };
+
+constexpr int kInputWeightsTensor[kNumGates] = {
+  kInputToInputWeightsTensor, kInputToForgetWeightsTensor,
+  kInputToCellWeightsTensor, kInputToOutputWeightsTensor
+};
+constexpr int kRecurrentWeightsTensor[kNumGates] = {
+  kRecurrentToInputWeightsTensor, kRecurrentToForgetWeightsTensor,
+  kRecurrentToCellWeightsTensor, kRecurrentToOutputWeightsTensor
+};
+constexpr int kGateBiasTensor[kNumGates] = {
+  kInputGateBiasTensor, kForgetGateBiasTensor,
+  kCellGateBiasTensor, kOutputGateBiasTensor
+};
+
+// The input-to-gate and recurrent-to-gate matrix-vector products are each
+// requantized to int8 with a fixed point scale of 2^-kGateFractionalBits,
+// i.e. Q3.4 covering [-8, 8). Their sum is a Q4.4 value in [-256, 254] which
+// directly indexes the sigmoid and tanh lookup tables below.
+constexpr int kGateFractionalBits = 4;
+constexpr int kLutHalfSize = 256;
+constexpr int kLutSize = 2 * kLutHalfSize + 1;
+
+enum op_support { kMvp, kCmsisNN, kTFLMrefF32 };
+
+struct OpData {
+  op_support supported;
+  bool       use_cifg;
+  int        scratch_buffer_index;
+
+  // Per gate matrix-vector programs, [0] is the input part and [1] is the
+  // recurrent part of the gate.
+  sli_mvp_ml_fully_connected_s8_params_t fc_params[2][kNumGates];
+
+  // CMSIS-NN output multiplier and shift of the same products.
+  int32_t    fc_output_multiplier[2][kNumGates];
+  int32_t    fc_output_shift[2][kNumGates];
+  int32_t    *zero_bias;
+
+  // Q0.15 nonlinearities, indexed by a Q4.4 gate value offset by kLutHalfSize.
+  int16_t    *sigmoid_lut;
+  int16_t    *tanh_lut;
+
+  // Cell state is int16 with a power of two scale of 2^-cell_state_shift.
+  int        cell_state_shift;
+  int16_t    quantized_cell_clip;
+
+  // Requantization of the Q0.30 hidden state into the int8 output.
+  int32_t    hidden_multiplier;
+  int        hidden_shift;
+  int32_t    hidden_zero_point;
+
+  // Used only for float evals:
+  float      cell_clip_f32;
+};
+
+sli_nn_shape_t shape2d(int rows, int cols)
+{
+  sli_nn_shape_t shape = {0};
+  shape.dim[0] = rows;
+  shape.dim[1] = cols;
+  return shape;
+}
+
+inline int16_t saturate_int16(int32_t value)
+{
+  return static_cast<int16_t>(std::min<int32_t>(std::max<int32_t>(value, INT16_MIN), INT16_MAX));
+}
+
+inline int16_t float_to_q15(float value)
+{
+  return saturate_int16(static_cast<int32_t>(std::round(value * 32768.0f)));
+}
+
+// Evaluate a lookup table at a fixed point value with frac_bits fractional
+// bits, interpolating linearly between the Q4.4 table entries.
+inline int16_t lut_lookup(const int16_t *lut, int32_t value, int frac_bits)
+{
+  int32_t index;
+  int32_t frac = 0;
+  const int extra_bits = frac_bits - kGateFractionalBits;
+
+  if (extra_bits > 0) {
+    index = value >> extra_bits;
+    frac  = value & ((1 << extra_bits) - 1);
+  } else {
+    index = value << -extra_bits;
+  }
+  if (index < -kLutHalfSize) {
+    return lut[0];
+  }
+  if (index >= kLutHalfSize) {
+    return lut[kLutSize - 1];
+  }
+  const int32_t y0 = lut[index + kLutHalfSize];
+  if (frac == 0) {
+    return static_cast<int16_t>(y0);
+  }
+  const int32_t y1 = lut[index + kLutHalfSize + 1];
+  return static_cast<int16_t>(y0 + (((y1 - y0) * frac) >> extra_bits));
+}
+
+void populate_luts(int16_t *sigmoid_lut, int16_t *tanh_lut)
+{
+  for (int i = 0; i < kLutSize; i++) {
+    const float x = static_cast<float>(i - kLutHalfSize) / (1 << kGateFractionalBits);
+    sigmoid_lut[i] = float_to_q15(1.0f / (1.0f + std::exp(-x)));
+    tanh_lut[i]    = float_to_q15(std::tanh(x));
+  }
+}
+
+void* Init(TfLiteContext* context, const char* buffer, size_t length)
+{
+  (void)buffer;
+  (void)length;
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+TfLiteStatus PrepareInt8(TfLiteContext* context, TfLiteNode* node, OpData* data,
+                         const TfLiteUnidirectionalSequenceLSTMParams* params,
+                         const TfLiteTensor* input,
+                         const TfLiteTensor* output_state,
+                         const TfLiteTensor* cell_state,
+                         const TfLiteTensor* output,
+                         int n_input, int n_cell)
+{
+  MicroContext* micro_context = GetMicroContext(context);
+
+  TF_LITE_ENSURE_TYPES_EQ(context, output_state->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, cell_state->type, kTfLiteInt16);
+  TF_LITE_ENSURE_EQ(context, params->activation, kTfLiteActTanh);
+
+  // The hidden output of every step is copied to the output state, which the
+  // recurrent weights then read with the output state quantization.
+  TF_LITE_ENSURE_EQ(context, output_state->params.scale, output->params.scale);
+  TF_LITE_ENSURE_EQ(context, output_state->params.zero_point, output->params.zero_point);
+
+  // The cell state must use a power of two scale.
+  int cell_state_shift;
+  TF_LITE_ENSURE(context, CheckedLog2(cell_state->params.scale, &cell_state_shift));
+  data->cell_state_shift = -cell_state_shift;
+  TF_LITE_ENSURE(context, data->cell_state_shift >= 0 && data->cell_state_shift <= 15);
+  data->quantized_cell_clip = 0;
+  if (params->cell_clip > 0.0f) {
+    data->quantized_cell_clip = saturate_int16(
+      static_cast<int32_t>(params->cell_clip / cell_state->params.scale));
+  }
+
+  const double hidden_scale = std::ldexp(1.0, -30) / output->params.scale;
+  QuantizeMultiplier(hidden_scale, &data->hidden_multiplier, &data->hidden_shift);
+  data->hidden_zero_point = output->params.zero_point;
+
+  const double gate_scale = std::ldexp(1.0, -kGateFractionalBits);
+  const float part_input_scale[2] = { input->params.scale, output_state->params.scale };
+  const int32_t part_input_zero_point[2] = { input->params.zero_point, output_state->params.zero_point };
+  const int part_depth[2] = { n_input, n_cell };
+
+  bool use_mvp = kernel_backend::MvpEnabled();
+  for (int g = 0; g < kNumGates; g++) {
+    if (data->use_cifg && g == kInputGate) {
+      continue;
+    }
+    for (int part = 0; part < 2; part++) {
+      const int weight_index = part == 0 ? kInputWeightsTensor[g] : kRecurrentWeightsTensor[g];
+      TfLiteTensor* weight = micro_context->AllocateTempInputTensor(node, weight_index);
+      TF_LITE_ENSURE(context, weight != nullptr);
+      TF_LITE_ENSURE_TYPES_EQ(context, weight->type, kTfLiteInt8);
+      TF_LITE_ENSURE_EQ(context, weight->params.zero_point, 0);
+
+      const double real_multiplier = part_input_scale[part] * weight->params.scale / gate_scale;
+
+      sli_mvp_ml_fully_connected_s8_params_t *fc = &data->fc_params[part][g];
+      fc->input             = nullptr;
+      fc->input_shape       = shape2d(1, part_depth[part]);
+      fc->input_offset      = -part_input_zero_point[part];
+      fc->weight            = GetTensorData<int8_t>(weight);
+      fc->weight_shape      = shape2d(n_cell, part_depth[part]);
+      fc->weight_offset     = 0;
+      fc->bias              = nullptr;
+      fc->bias_length       = 0;
+      fc->output            = nullptr;
+      fc->output_shape      = shape2d(1, n_cell);
+      fc->output_offset     = 0;
+      fc->output_multiplier = sli_mvp_ml_fully_connected_output_multiplier(real_multiplier);
+      fc->activation_min    = INT8_MIN;
+      fc->activation_max    = INT8_MAX;
+
+      int exponent;
+      QuantizeMultiplier(real_multiplier, &data->fc_output_multiplier[part][g], &exponent);
+      data->fc_output_shift[part][g] = exponent;
+
+      micro_context->DeallocateTempTfLiteTensor(weight);
+    }
+
+    TfLiteTensor* bias = micro_context->AllocateTempInputTensor(node, kGateBiasTensor[g]);
+    TF_LITE_ENSURE(context, bias != nullptr);
+    TF_LITE_ENSURE_TYPES_EQ(context, bias->type, kTfLiteInt32);
+    data->fc_params[0][g].bias_length = n_cell;
+
+    micro_context->DeallocateTempTfLiteTensor(bias);
+
+    use_mvp = use_mvp
+              && sli_mvp_ml_fully_connected_s8_is_supported(&data->fc_params[0][g])
+              && sli_mvp_ml_fully_connected_s8_is_supported(&data->fc_params[1][g]);
+  }
+
+  if (use_mvp) {
+    // The biases are only converted once every gate is known to run on the
+    // MVP, so that the CMSIS-NN path does not hold unused fp16 copies.
+    for (int g = 0; g < kNumGates; g++) {
+      if (data->use_cifg && g == kInputGate) {
+        continue;
+      }
+      TfLiteTensor* bias = micro_context->AllocateTempInputTensor(node, kGateBiasTensor[g]);
+      TF_LITE_ENSURE(context, bias != nullptr);
+      // Convert int32_t to float16_t as the MVP does not support loading int32 values.
+      float16_t *bias_data = static_cast<float16_t*>(
+        context->AllocatePersistentBuffer(context, n_cell * sizeof(float16_t)));
+      TF_LITE_ENSURE(context, bias_data != nullptr);
+      sl_status_t status = sli_mvp_ml_fully_connected_bias_convert(
+        GetTensorData<int32_t>(bias), bias_data, n_cell);
+      TF_LITE_ENSURE_EQ(context, SL_STATUS_OK, status);
+      data->fc_params[0][g].bias = bias_data;
+      micro_context->DeallocateTempTfLiteTensor(bias);
+    }
+
+    data->supported = kMvp;
+    kernel_backend::Report(kernel_backend::kMvp);
+  } else {
+    kernel_backend::Report(kernel_backend::kCmsisNN);
+    data->supported = kCmsisNN;
+    // arm_fully_connected_s8 requires a bias, the recurrent part has none.
+    data->zero_bias = static_cast<int32_t*>(
+      context->AllocatePersistentBuffer(context, n_cell * sizeof(int32_t)));
+    TF_LITE_ENSURE(context, data->zero_bias != nullptr);
+    memset(data->zero_bias, 0, n_cell * sizeof(int32_t));
+  }
+
+  data->sigmoid_lut = static_cast<int16_t*>(
+    context->AllocatePersistentBuffer(context, kLutSize * sizeof(int16_t)));
+  data->tanh_lut = static_cast<int16_t*>(
+    context->AllocatePersistentBuffer(context, kLutSize * sizeof(int16_t)));
+  TF_LITE_ENSURE(context, data->sigmoid_lut != nullptr && data->tanh_lut != nullptr);
+  populate_luts(data->sigmoid_lut, data->tanh_lut);
+
+  // Scratch: the int8 input and recurrent parts of one gate, followed by the
+  // int16 activations of all four gates.
+  const int scratch_buffer_size = 2 * n_cell * sizeof(int8_t)
+                                  + kNumGates * n_cell * sizeof(int16_t);
+  return context->RequestScratchBufferInArena(context, scratch_buffer_size,
+                                              &data->scratch_buffer_index);
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node)
+{
+  TFLITE_DCHECK(node->user_data    != nullptr);
+  TFLITE_DCHECK(node->builtin_data != nullptr);
+
+  OpData* data = static_cast<OpData*>(node->user_data);
+  const auto params =
+    static_cast<const TfLiteUnidirectionalSequenceLSTMParams*>(node->builtin_data);
+
+  MicroContext* micro_context = GetMicroContext(context);
+
+  TF_LITE_ENSURE(context, NumInputs(node) == 20 || NumInputs(node) == 24);
+  TF_LITE_ENSURE_EQ(context, NumOutputs(node), 1);
+
+  // Peephole connections, projection and layer normalization are not
+  // supported by this kernel.
+  const int unsupported_tensors[] = {
+    kCellToInputWeightsTensor, kCellToForgetWeightsTensor,
+    kCellToOutputWeightsTensor, kProjectionWeightsTensor, kProjectionBiasTensor
+  };
+  for (int index : unsupported_tensors) {
+    if (node->inputs->data[index] != kTfLiteOptionalTensor) {
+      TF_LITE_KERNEL_LOG(context, "LSTM peephole and projection are not supported.");
+      return kTfLiteError;
+    }
+  }
+  if (NumInputs(node) == 24) {
+    for (int i = kInputLayerNormCoefficientsTensor; i < 24; i++) {
+      if (node->inputs->data[i] != kTfLiteOptionalTensor) {
+        TF_LITE_KERNEL_LOG(context, "LSTM layer normalization is not supported.");
+        return kTfLiteError;
+      }
+    }
+  }
+  data->use_cifg = node->inputs->data[kInputToInputWeightsTensor] == kTfLiteOptionalTensor;
+
+  TfLiteTensor* input =
+    micro_context->AllocateTempInputTensor(node, kInputTensor);
+  TfLiteTensor* output_state =
+    micro_context->AllocateTempInputTensor(node, kOutputStateTensor);
+  TfLiteTensor* cell_state =
+    micro_context->AllocateTempInputTensor(node, kCellStateTensor);
+  TfLiteTensor* output =
+    micro_context->AllocateTempOutputTensor(node, kOutputTensor);
+  TfLiteTensor* forget_weights =
+    micro_context->AllocateTempInputTensor(node, kInputToForgetWeightsTensor);
+
+  TF_LITE_ENSURE(context, input          != nullptr);
+  TF_LITE_ENSURE(context, output_state   != nullptr);
+  TF_LITE_ENSURE(context, cell_state     != nullptr);
+  TF_LITE_ENSURE(context, output         != nullptr);
+  TF_LITE_ENSURE(context, forget_weights != nullptr);
+  TF_LITE_ENSURE(context, IsVariableTensor(output_state));
+  TF_LITE_ENSURE(context, IsVariableTensor(cell_state));
+  TF_LITE_ENSURE_EQ(context, input->dims->size, 3);
+
+  const int n_input = input->dims->data[2];
+  const int n_cell  = forget_weights->dims->data[0];
+  TF_LITE_ENSURE_EQ(context, forget_weights->dims->data[1], n_input);
+  TF_LITE_ENSURE_EQ(context, output->dims->data[2], n_cell);
+
+  TfLiteStatus status = kTfLiteOk;
+  if (input->type == kTfLiteInt8 && forget_weights->type == kTfLiteInt8) {
+    status = PrepareInt8(context, node, data, params, input, output_state,
+                         cell_state, output, n_input, n_cell);
+  } else if (input->type == kTfLiteFloat32 && forget_weights->type == kTfLiteFloat32) {
+    data->supported = kTFLMrefF32;
+    kernel_backend::Report(kernel_backend::kReference);
+    data->cell_clip_f32 = params->cell_clip;
+    status = context->RequestScratchBufferInArena(
+      context, kNumGates * n_cell * sizeof(float), &data->scratch_buffer_index);
+  } else {
+    TF_LITE_KERNEL_LOG(context, "Type %s with weights %s not currently supported.",
+                       TfLiteTypeGetName(input->type),
+                       TfLiteTypeGetName(forget_weights->type));
+    status = kTfLiteError;
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(output_state);
+  micro_context->DeallocateTempTfLiteTensor(cell_state);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  micro_context->DeallocateTempTfLiteTensor(forget_weights);
+
+  return status;
+}
+
+// Compute one gate part (W * x + b) as Q3.4 int8 values.
+TfLiteStatus gate_part_int8(TfLiteContext* context, const OpData* data,
+                            int part, int g,
+                            const int8_t *vector,
+                            const TfLiteEvalTensor* weight,
+                            const TfLiteEvalTensor* bias,
+                            int8_t *gate_out)
+{
+  sli_mvp_ml_fully_connected_s8_params_t params = data->fc_params[part][g];
+
+  if (data->supported == kMvp) {
+    params.input  = vector;
+    params.weight = tflite::micro::GetTensorData<int8_t>(weight);
+    params.output = gate_out;
+    sl_status_t status = sli_mvp_ml_fully_connected_s8(&params);
+    TF_LITE_ENSURE_EQ(context, SL_STATUS_OK, status);
+    return kTfLiteOk;
+  }
+
+  const int depth  = params.weight_shape.dim[1];
+  const int n_cell = params.weight_shape.dim[0];
+
+  cmsis_nn_fc_params fc_params;
+  fc_params.input_offset   = params.input_offset;
+  fc_params.filter_offset  = 0;
+  fc_params.output_offset  = 0;
+  fc_params.activation.min = INT8_MIN;
+  fc_params.activation.max = INT8_MAX;
+
+  cmsis_nn_per_tensor_quant_params quant_params;
+  quant_params.multiplier = data->fc_output_multiplier[part][g];
+  quant_params.shift      = data->fc_output_shift[part][g];
+
+  cmsis_nn_dims input_dims  = { 1, 1, 1, depth };
+  cmsis_nn_dims filter_dims = { depth, 1, 1, n_cell };
+  cmsis_nn_dims bias_dims   = { 1, 1, 1, n_cell };
+  cmsis_nn_dims output_dims = { 1, 1, 1, n_cell };
+
+  cmsis_nn_context ctx;
+  ctx.buf  = nullptr;
+  ctx.size = 0;
+
+  TF_LITE_ENSURE_EQ(
+    context,
+    arm_fully_connected_s8(
+      &ctx, &fc_params, &quant_params, &input_dims, vector, &filter_dims,
+      tflite::micro::GetTensorData<int8_t>(weight), &bias_dims,
+      bias != nullptr ? tflite::micro::GetTensorData<int32_t>(bias) : data->zero_bias,
+      &output_dims, gate_out),
+    ARM_CMSIS_NN_SUCCESS);
+  return kTfLiteOk;
+}
+
+TfLiteStatus eval_int8(TfLiteContext* context, TfLiteNode* node,
+                       const OpData* data, bool time_major)
+{
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, kInputTensor);
+  TfLiteEvalTensor* output_state = tflite::micro::GetMutableEvalInput(context, node, kOutputStateTensor);
+  TfLiteEvalTensor* cell_state   = tflite::micro::GetMutableEvalInput(context, node, kCellStateTensor);
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+
+  const TfLiteEvalTensor* input_weights[kNumGates];
+  const TfLiteEvalTensor* recurrent_weights[kNumGates];
+  const TfLiteEvalTensor* biases[kNumGates];
+  for (int g = 0; g < kNumGates; g++) {
+    if (data->use_cifg && g == kInputGate) {
+      continue;
+    }
+    input_weights[g]     = tflite::micro::GetEvalInput(context, node, kInputWeightsTensor[g]);
+    recurrent_weights[g] = tflite::micro::GetEvalInput(context, node, kRecurrentWeightsTensor[g]);
+    biases[g]            = tflite::micro::GetEvalInput(context, node, kGateBiasTensor[g]);
+  }
+
+  const int max_time = time_major ? input->dims->data[0] : input->dims->data[1];
+  const int n_batch  = time_major ? input->dims->data[1] : input->dims->data[0];
+  const int n_input  = input->dims->data[2];
+  const int n_cell   = output->dims->data[2];
+
+  int8_t *scratch = static_cast<int8_t*>(
+    context->GetScratchBuffer(context, data->scratch_buffer_index));
+  TF_LITE_ENSURE(context, scratch != nullptr);
+  int8_t  *input_part     = scratch;
+  int8_t  *recurrent_part = scratch + n_cell;
+  int16_t *gates          = reinterpret_cast<int16_t*>(scratch + 2 * n_cell);
+
+  const int cell_shift = data->cell_state_shift;
+
+  for (int t = 0; t < max_time; t++) {
+    for (int b = 0; b < n_batch; b++) {
+      const int offset = time_major ? (t * n_batch + b) : (b * max_time + t);
+      const int8_t *x = tflite::micro::GetTensorData<int8_t>(input) + offset * n_input;
+      int8_t *h_out   = tflite::micro::GetTensorData<int8_t>(output) + offset * n_cell;
+      int8_t *h       = tflite::micro::GetTensorData<int8_t>(output_state) + b * n_cell;
+      int16_t *c      = tflite::micro::GetTensorData<int16_t>(cell_state) + b * n_cell;
+
+      // All gates are computed from the previous hidden state before it is
+      // updated.
+      for (int g = 0; g < kNumGates; g++) {
+        if (data->use_cifg && g == kInputGate) {
+          continue;
+        }
+        TF_LITE_ENSURE_OK(context, gate_part_int8(context, data, 0, g, x, input_weights[g],
+                                                  biases[g], input_part));
+        TF_LITE_ENSURE_OK(context, gate_part_int8(context, data, 1, g, h, recurrent_weights[g],
+                                                  nullptr, recurrent_part));
+        const int16_t *lut = g == kCellGate ? data->tanh_lut : data->sigmoid_lut;
+        int16_t *gate = gates + g * n_cell;
+        for (int i = 0; i < n_cell; i++) {
+          gate[i] = lut[input_part[i] + recurrent_part[i] + kLutHalfSize];
+        }
+      }
+
+      const int16_t *forget_gate = gates + kForgetGate * n_cell;
+      const int16_t *cell_gate   = gates + kCellGate * n_cell;
+      const int16_t *output_gate = gates + kOutputGate * n_cell;
+      int16_t *input_gate        = gates + kInputGate * n_cell;
+      if (data->use_cifg) {
+        for (int i = 0; i < n_cell; i++) {
+          input_gate[i] = INT16_MAX - forget_gate[i];
+        }
+      }
+
+      for (int i = 0; i < n_cell; i++) {
+        // c = f * c + i * g, with f, i and g in Q0.15.
+        const int32_t forget_term = (forget_gate[i] * c[i] + (1 << 14)) >> 15;
+        const int32_t input_term  = (input_gate[i] * cell_gate[i]
+                                     + (1 << (29 - cell_shift))) >> (30 - cell_shift);
+        int32_t cell = forget_term + input_term;
+        if (data->quantized_cell_clip > 0) {
+          cell = std::min<int32_t>(std::max<int32_t>(cell, -data->quantized_cell_clip),
+                                   data->quantized_cell_clip);
+        }
+        c[i] = saturate_int16(cell);
+
+        // h = o * tanh(c), requantized from Q0.30 to the output scale.
+        const int32_t hidden = output_gate[i] * lut_lookup(data->tanh_lut, c[i], cell_shift);
+        int32_t value = MultiplyByQuantizedMultiplier(hidden, data->hidden_multiplier,
+                                                      data->hidden_shift)
+                        + data->hidden_zero_point;
+        value = std::min<int32_t>(std::max<int32_t>(value, INT8_MIN), INT8_MAX);
+        h_out[i] = static_cast<int8_t>(value);
+      }
+      memcpy(h, h_out, n_cell);
+    }
+  }
+
+  return kTfLiteOk;
+}
+
+inline float sigmoid_f32(float x)
+{
+  return 1.0f / (1.0f + std::exp(-x));
+}
+
+TfLiteStatus eval_float(TfLiteContext* context, TfLiteNode* node,
+                        const OpData* data, bool time_major)
+{
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, kInputTensor);
+  TfLiteEvalTensor* output_state = tflite::micro::GetMutableEvalInput(context, node, kOutputStateTensor);
+  TfLiteEvalTensor* cell_state   = tflite::micro::GetMutableEvalInput(context, node, kCellStateTensor);
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+
+  const float *input_weights[kNumGates] = { nullptr };
+  const float *recurrent_weights[kNumGates] = { nullptr };
+  const float *biases[kNumGates] = { nullptr };
+  for (int g = 0; g < kNumGates; g++) {
+    if (data->use_cifg && g == kInputGate) {
+      continue;
+    }
+    input_weights[g] = tflite::micro::GetTensorData<float>(
+      tflite::micro::GetEvalInput(context, node, kInputWeightsTensor[g]));
+    recurrent_weights[g] = tflite::micro::GetTensorData<float>(
+      tflite::micro::GetEvalInput(context, node, kRecurrentWeightsTensor[g]));
+    biases[g] = tflite::micro::GetTensorData<float>(
+      tflite::micro::GetEvalInput(context, node, kGateBiasTensor[g]));
+  }
+
+  const int max_time = time_major ? input->dims->data[0] : input->dims->data[1];
+  const int n_batch  = time_major ? input->dims->data[1] : input->dims->data[0];
+  const int n_input  = input->dims->data[2];
+  const int n_cell   = output->dims->data[2];
+
+  float *gates = static_cast<float*>(
+    context->GetScratchBuffer(context, data->scratch_buffer_index));
+  TF_LITE_ENSURE(context, gates != nullptr);
+
+  for (int t = 0; t < max_time; t++) {
+    for (int b = 0; b < n_batch; b++) {
+      const int offset = time_major ? (t * n_batch + b) : (b * max_time + t);
+      const float *x = tflite::micro::GetTensorData<float>(input) + offset * n_input;
+      float *h_out   = tflite::micro::GetTensorData<float>(output) + offset * n_cell;
+      float *h       = tflite::micro::GetTensorData<float>(output_state) + b * n_cell;
+      float *c       = tflite::micro::GetTensorData<float>(cell_state) + b * n_cell;
+
+      for (int g = 0; g < kNumGates; g++) {
+        if (data->use_cifg && g == kInputGate) {
+          continue;
+        }
+        float *gate = gates + g * n_cell;
+        for (int i = 0; i < n_cell; i++) {
+          float acc = biases[g][i];
+          for (int j = 0; j < n_input; j++) {
+            acc += input_weights[g][i * n_input + j] * x[j];
+          }
+          for (int j = 0; j < n_cell; j++) {
+            acc += recurrent_weights[g][i * n_cell + j] * h[j];
+          }
+          gate[i] = g == kCellGate ? std::tanh(acc) : sigmoid_f32(acc);
+        }
+      }
+
+      const float *forget_gate = gates + kForgetGate * n_cell;
+      const float *cell_gate   = gates + kCellGate * n_cell;
+      const float *output_gate = gates + kOutputGate * n_cell;
+      const float *input_gate  = gates + kInputGate * n_cell;
+
+      for (int i = 0; i < n_cell; i++) {
+        const float i_gate = data->use_cifg ? 1.0f - forget_gate[i] : input_gate[i];
+        float cell = forget_gate[i] * c[i] + i_gate * cell_gate[i];
+        if (data->cell_clip_f32 > 0.0f) {
+          cell = std::min(std::max(cell, -data->cell_clip_f32), data->cell_clip_f32);
+        }
+        c[i] = cell;
+        h_out[i] = output_gate[i] * std::tanh(cell);
+      }
+      memcpy(h, h_out, n_cell * sizeof(float));
+    }
+  }
+
+  return kTfLiteOk;
+}
+
+TfLiteStatus Invoke(TfLiteContext* context, TfLiteNode* node)
+{
+  TfLiteStatus status = kTfLiteError;
+
+  TFLITE_DCHECK(node->user_data    != nullptr);
+  TFLITE_DCHECK(node->builtin_data != nullptr);
+
+  const auto params =
+    static_cast<const TfLiteUnidirectionalSequenceLSTMParams*>(node->builtin_data);
+  const OpData* data = static_cast<const OpData*>(node->user_data);
+
+  if (data->supported == kMvp || data->supported == kCmsisNN) {
+    status = eval_int8(context, node, data, params->time_major);
+
+  } else if (data->supported == kTFLMrefF32) {
+    status = eval_float(context, node, data, params->time_major);
+  }
+
+  return status;
+}
+
+}  // namespace unidirectional_sequence_lstm
+}  // namespace sl
+
+TFLMRegistration Register_UNIDIRECTIONAL_SEQUENCE_LSTM() {
+  return tflite::micro::RegisterOp(sl::unidirectional_sequence_lstm::Init,
+                                   sl::unidirectional_sequence_lstm::Prepare,
+                                   sl::unidirectional_sequence_lstm::Invoke);
+}
+
+TFLMRegistration Register_UNIDIRECTIONAL_SEQUENCE_LSTM_INT8() {
+  return tflite::micro::RegisterOp(sl::unidirectional_sequence_lstm::Init,
+                                   sl::unidirectional_sequence_lstm::Prepare,
+                                   sl::unidirectional_sequence_lstm::Invoke);
+}
+
+}  // namespace tflite
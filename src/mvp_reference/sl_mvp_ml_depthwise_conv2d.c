@@ -0,0 +1,112 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model depthwise conv2d kernel.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_mvp_ml_depthwise_conv2d.h"
+#include "sli_mvp_reference.h"
+
+bool sli_mvp_ml_depthwise_conv2d_s8_is_supported(const sli_mvp_ml_depthwise_conv2d_s8_params_t *params)
+{
+  if (params == NULL) {
+    return false;
+  }
+
+  return params->batches > 0
+         && sli_mvp_ref_dim_valid(params->in_channels)
+         && params->out_channels == params->in_channels
+         && sli_mvp_ref_dim_valid(params->input_height)
+         && sli_mvp_ref_dim_valid(params->input_width)
+         && sli_mvp_ref_dim_valid(params->output_height)
+         && sli_mvp_ref_dim_valid(params->output_width)
+         && sli_mvp_ref_dim_valid(params->filter_height)
+         && sli_mvp_ref_dim_valid(params->filter_width)
+         && params->stride_height > 0 && params->stride_width > 0
+         // Dilation is not implemented by the reference.
+         && params->dilation_height == 1 && params->dilation_width == 1
+         && params->pad_height >= 0 && params->pad_width >= 0
+         && params->output_activation_min <= params->output_activation_max;
+}
+
+sl_status_t sli_mvp_ml_depthwise_conv2d_s8(const sli_mvp_ml_depthwise_conv2d_s8_params_t *params)
+{
+  if (!sli_mvp_ml_depthwise_conv2d_s8_is_supported(params)
+      || params->input == NULL || params->output == NULL
+      || params->filter == NULL || params->output_scaler == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  const int channels = params->out_channels;
+  const float16_t scaler = (float16_t)SLI_MVP_ACCUMULATOR_SCALER;
+
+  for (int b = 0; b < params->batches; b++) {
+    const int8_t *input = params->input
+                          + b * params->input_height * params->input_width * channels;
+
+    for (int oy = 0; oy < params->output_height; oy++) {
+      int8_t *output = params->output
+                       + ((b * params->output_height + oy) * params->output_width) * channels;
+      uint32_t macs = 0;
+
+      for (int ox = 0; ox < params->output_width; ox++) {
+        for (int c = 0; c < channels; c++) {
+          float16_t sum = params->bias != NULL ? params->bias[c] : (float16_t)0.0f;
+
+          for (int fy = 0; fy < params->filter_height; fy++) {
+            const int iy = oy * params->stride_height - params->pad_height + fy;
+            if (iy < 0 || iy >= params->input_height) {
+              continue;
+            }
+            for (int fx = 0; fx < params->filter_width; fx++) {
+              const int ix = ox * params->stride_width - params->pad_width + fx;
+              if (ix < 0 || ix >= params->input_width) {
+                continue;
+              }
+              const int8_t in = input[(iy * params->input_width + ix) * channels + c];
+              const int8_t w = params->filter[(fy * params->filter_width + fx) * channels + c];
+              const float16_t x = sli_mvp_ref_from_int(in + params->input_offset);
+              sum = sli_mvp_ref_mac(x, sli_mvp_ref_mul(sli_mvp_ref_from_int(w), scaler), sum);
+              macs++;
+            }
+          }
+
+          output[ox * channels + c] = sli_mvp_ref_to_int8(sli_mvp_ref_mul(sum, params->output_scaler[c]),
+                                                          params->output_offset,
+                                                          params->output_activation_min,
+                                                          params->output_activation_max);
+        }
+      }
+
+      // One program per output row.
+      sli_mvp_ref_program(sli_mvp_ref_instructions(macs)
+                          + (uint32_t)(params->output_width * channels));
+    }
+  }
+
+  return SL_STATUS_OK;
+}
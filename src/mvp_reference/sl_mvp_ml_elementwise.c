@@ -0,0 +1,84 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model elementwise kernels.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_mvp_ml_add.h"
+#include "sl_mvp_ml_mul.h"
+#include "sli_mvp_reference.h"
+
+sl_status_t sli_mvp_ml_add_s8(const sli_mvp_ml_add_s8_params_t *params)
+{
+  if (params == NULL || params->input1 == NULL || params->input2 == NULL
+      || params->output == NULL || params->length == 0
+      || params->activation_min > params->activation_max) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  const float16_t multiplier1 = sli_mvp_ref_from_float(params->input1_multiplier);
+  const float16_t multiplier2 = sli_mvp_ref_from_float(params->input2_multiplier);
+  const float16_t output_multiplier = sli_mvp_ref_from_float(params->output_multiplier);
+
+  for (size_t i = 0; i < params->length; i++) {
+    const float16_t x1 = sli_mvp_ref_from_int(params->input1[i] + params->input1_offset);
+    const float16_t x2 = sli_mvp_ref_from_int(params->input2[i] + params->input2_offset);
+    const float16_t sum = sli_mvp_ref_mac(x2, multiplier2, sli_mvp_ref_mul(x1, multiplier1));
+    params->output[i] = sli_mvp_ref_to_int8(sli_mvp_ref_mul(sum, output_multiplier),
+                                            params->output_offset,
+                                            params->activation_min,
+                                            params->activation_max);
+  }
+
+  // Scale, multiply-accumulate and output scale per element.
+  sli_mvp_ref_program(3U * sli_mvp_ref_instructions((uint32_t)params->length));
+  return SL_STATUS_OK;
+}
+
+sl_status_t sli_mvp_ml_mul_s8(const sli_mvp_ml_mul_s8_params_t *params)
+{
+  if (params == NULL || params->input1 == NULL || params->input2 == NULL
+      || params->output == NULL || params->length == 0
+      || params->activation_min > params->activation_max) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  const float16_t output_multiplier = sli_mvp_ref_from_float(params->output_multiplier);
+
+  for (size_t i = 0; i < params->length; i++) {
+    const float16_t x1 = sli_mvp_ref_from_int(params->input1[i] + params->input1_offset);
+    const float16_t x2 = sli_mvp_ref_from_int(params->input2[i] + params->input2_offset);
+    params->output[i] = sli_mvp_ref_to_int8(sli_mvp_ref_mul(sli_mvp_ref_mul(x1, x2), output_multiplier),
+                                            params->output_offset,
+                                            params->activation_min,
+                                            params->activation_max);
+  }
+
+  // Multiply and output scale per element.
+  sli_mvp_ref_program(2U * sli_mvp_ref_instructions((uint32_t)params->length));
+  return SL_STATUS_OK;
+}
@@ -0,0 +1,124 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model fully connected kernel.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_mvp_ml_fully_connected.h"
+#include "sli_mvp_reference.h"
+
+static uint32_t shape_size(const sli_nn_shape_t *shape)
+{
+  uint32_t size = 1;
+  for (int i = 0; i < 4 && shape->dim[i] != 0; i++) {
+    size *= shape->dim[i];
+  }
+  return size;
+}
+
+bool sli_mvp_ml_fully_connected_s8_is_supported(const sli_mvp_ml_fully_connected_s8_params_t *params)
+{
+  if (params == NULL) {
+    return false;
+  }
+
+  const uint32_t units = params->weight_shape.dim[0];
+  const uint32_t depth = params->weight_shape.dim[1];
+  if (!sli_mvp_ref_dim_valid((int)units) || depth == 0
+      || params->weight_shape.dim[2] != 0) {
+    return false;
+  }
+
+  const uint32_t input_size = shape_size(&params->input_shape);
+  if (input_size % depth != 0
+      || shape_size(&params->output_shape) != input_size / depth * units
+      || !sli_mvp_ref_dim_valid((int)(input_size / depth))) {
+    return false;
+  }
+
+  if (params->bias != NULL && params->bias_length != units) {
+    return false;
+  }
+
+  return params->activation_min <= params->activation_max;
+}
+
+sl_status_t sli_mvp_ml_fully_connected_s8(const sli_mvp_ml_fully_connected_s8_params_t *params)
+{
+  if (!sli_mvp_ml_fully_connected_s8_is_supported(params)
+      || params->input == NULL || params->weight == NULL || params->output == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  const int units   = (int)params->weight_shape.dim[0];
+  const int depth   = (int)params->weight_shape.dim[1];
+  const int batches = (int)(shape_size(&params->input_shape) / (uint32_t)depth);
+  const float16_t scaler = (float16_t)SLI_MVP_ACCUMULATOR_SCALER;
+
+  for (int b = 0; b < batches; b++) {
+    const int8_t *input = params->input + b * depth;
+    int8_t *output = params->output + b * units;
+
+    for (int u = 0; u < units; u++) {
+      const int8_t *weight = params->weight + u * depth;
+      float16_t acc = params->bias != NULL ? params->bias[u] : (float16_t)0.0f;
+
+      for (int k = 0; k < depth; k++) {
+        const float16_t x = sli_mvp_ref_from_int(input[k] + params->input_offset);
+        const float16_t w = sli_mvp_ref_mul(sli_mvp_ref_from_int(weight[k] + params->weight_offset), scaler);
+        acc = sli_mvp_ref_mac(x, w, acc);
+      }
+
+      output[u] = sli_mvp_ref_to_int8(sli_mvp_ref_mul(acc, params->output_multiplier),
+                                      params->output_offset,
+                                      params->activation_min,
+                                      params->activation_max);
+    }
+  }
+
+  // One multiply-accumulate per weight and a scale and store per output.
+  sli_mvp_ref_program(sli_mvp_ref_instructions((uint32_t)(batches * units * depth))
+                      + (uint32_t)(batches * units));
+  return SL_STATUS_OK;
+}
+
+sl_status_t sli_mvp_ml_fully_connected_bias_convert(const int32_t *src, float16_t *dst, size_t length)
+{
+  if (src == NULL || dst == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    dst[i] = sli_mvp_ref_from_float((float)src[i] * SLI_MVP_ACCUMULATOR_SCALER);
+  }
+  return SL_STATUS_OK;
+}
+
+float16_t sli_mvp_ml_fully_connected_output_multiplier(double multiplier)
+{
+  return sli_mvp_ref_from_float((float)(multiplier * SLI_MVP_ACCUMULATOR_MULTIPLIER));
+}
@@ -0,0 +1,139 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model pooling kernels.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_mvp_ml_pooling.h"
+#include "sli_mvp_reference.h"
+
+static bool pooling_is_supported(const sli_mvp_ml_pooling_s8_params_t *params)
+{
+  if (params == NULL) {
+    return false;
+  }
+
+  return params->batches > 0
+         && sli_mvp_ref_dim_valid(params->channels)
+         && sli_mvp_ref_dim_valid(params->input_height)
+         && sli_mvp_ref_dim_valid(params->input_width)
+         && sli_mvp_ref_dim_valid(params->output_height)
+         && sli_mvp_ref_dim_valid(params->output_width)
+         && sli_mvp_ref_dim_valid(params->filter_height)
+         && sli_mvp_ref_dim_valid(params->filter_width)
+         && params->stride_height > 0 && params->stride_width > 0
+         && params->pad_height >= 0 && params->pad_width >= 0
+         && params->output_activation_min <= params->output_activation_max;
+}
+
+static sl_status_t pooling_s8(const sli_mvp_ml_pooling_s8_params_t *params, bool average)
+{
+  if (!pooling_is_supported(params) || params->input == NULL || params->output == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  const int channels = params->channels;
+
+  for (int b = 0; b < params->batches; b++) {
+    const int8_t *input = params->input
+                          + b * params->input_height * params->input_width * channels;
+
+    for (int oy = 0; oy < params->output_height; oy++) {
+      int8_t *output = params->output
+                       + ((b * params->output_height + oy) * params->output_width) * channels;
+      uint32_t loads = 0;
+
+      for (int ox = 0; ox < params->output_width; ox++) {
+        // Window clipped to the input, padding is not included.
+        const int y0 = oy * params->stride_height - params->pad_height;
+        const int x0 = ox * params->stride_width - params->pad_width;
+        const int y_start = y0 < 0 ? 0 : y0;
+        const int x_start = x0 < 0 ? 0 : x0;
+        int y_end = y0 + params->filter_height;
+        int x_end = x0 + params->filter_width;
+        y_end = y_end > params->input_height ? params->input_height : y_end;
+        x_end = x_end > params->input_width ? params->input_width : x_end;
+        const int count = (y_end - y_start) * (x_end - x_start);
+
+        for (int c = 0; c < channels; c++) {
+          float16_t sum = (float16_t)0.0f;
+          int32_t max = -128;
+
+          for (int y = y_start; y < y_end; y++) {
+            for (int x = x_start; x < x_end; x++) {
+              const int8_t value = input[(y * params->input_width + x) * channels + c];
+              if (average) {
+                sum = sli_mvp_ref_add(sum, sli_mvp_ref_from_int(value));
+              } else if (value > max) {
+                max = value;
+              }
+            }
+          }
+
+          if (average) {
+            const float16_t scale = count > 0 ? sli_mvp_ref_from_float(1.0f / (float)count)
+                                              : (float16_t)0.0f;
+            output[ox * channels + c] = sli_mvp_ref_to_int8(sli_mvp_ref_mul(sum, scale), 0,
+                                                            params->output_activation_min,
+                                                            params->output_activation_max);
+          } else {
+            output[ox * channels + c] = sli_mvp_ref_to_int8(sli_mvp_ref_from_int(max), 0,
+                                                            params->output_activation_min,
+                                                            params->output_activation_max);
+          }
+        }
+        loads += (uint32_t)(count * channels);
+      }
+
+      // One program per output row.
+      sli_mvp_ref_program(sli_mvp_ref_instructions(loads)
+                          + (uint32_t)(params->output_width * channels));
+    }
+  }
+
+  return SL_STATUS_OK;
+}
+
+bool sli_mvp_ml_average_pooling_s8_is_supported(const sli_mvp_ml_pooling_s8_params_t *params)
+{
+  return pooling_is_supported(params);
+}
+
+sl_status_t sli_mvp_ml_average_pooling_s8(const sli_mvp_ml_pooling_s8_params_t *params)
+{
+  return pooling_s8(params, true);
+}
+
+bool sli_mvp_ml_max_pooling_s8_is_supported(const sli_mvp_ml_pooling_s8_params_t *params)
+{
+  return pooling_is_supported(params);
+}
+
+sl_status_t sli_mvp_ml_max_pooling_s8(const sli_mvp_ml_pooling_s8_params_t *params)
+{
+  return pooling_s8(params, false);
+}
@@ -0,0 +1,125 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model transpose conv2d kernel.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_mvp_ml_transpose_conv2d.h"
+#include "sli_mvp_reference.h"
+
+bool sli_mvp_ml_transpose_conv2d_s8_is_supported(const sli_mvp_ml_transpose_conv2d_s8_params_t *params)
+{
+  if (params == NULL) {
+    return false;
+  }
+
+  return params->batches > 0
+         && sli_mvp_ref_dim_valid(params->in_channels)
+         && sli_mvp_ref_dim_valid(params->out_channels)
+         && sli_mvp_ref_dim_valid(params->input_height)
+         && sli_mvp_ref_dim_valid(params->input_width)
+         && sli_mvp_ref_dim_valid(params->output_height)
+         && sli_mvp_ref_dim_valid(params->output_width)
+         && sli_mvp_ref_dim_valid(params->filter_height)
+         && sli_mvp_ref_dim_valid(params->filter_width)
+         && params->stride_height > 0 && params->stride_width > 0
+         // Dilation is not implemented by the reference.
+         && params->dilation_height == 1 && params->dilation_width == 1
+         && params->pad_height >= 0 && params->pad_width >= 0
+         && params->output_activation_min <= params->output_activation_max;
+}
+
+sl_status_t sli_mvp_ml_transpose_conv2d_s8(const sli_mvp_ml_transpose_conv2d_s8_params_t *params)
+{
+  if (!sli_mvp_ml_transpose_conv2d_s8_is_supported(params)
+      || params->input == NULL || params->output == NULL
+      || params->filter == NULL || params->output_scaler == NULL
+      || params->scratch_buffer == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  const int in_ch  = params->in_channels;
+  const int out_ch = params->out_channels;
+  const int output_size = params->output_height * params->output_width * out_ch;
+  const float16_t scaler = (float16_t)SLI_MVP_ACCUMULATOR_SCALER;
+  float16_t *acc = params->scratch_buffer;
+
+  for (int b = 0; b < params->batches; b++) {
+    const int8_t *input = params->input
+                          + b * params->input_height * params->input_width * in_ch;
+    int8_t *output = params->output + b * output_size;
+
+    for (int i = 0; i < output_size; i++) {
+      acc[i] = params->bias != NULL ? params->bias[i % out_ch] : (float16_t)0.0f;
+    }
+    sli_mvp_ref_program((uint32_t)output_size);
+
+    // Scatter every input pixel over the output, one program per input row.
+    for (int iy = 0; iy < params->input_height; iy++) {
+      uint32_t macs = 0;
+
+      for (int ix = 0; ix < params->input_width; ix++) {
+        const int8_t *in = input + (iy * params->input_width + ix) * in_ch;
+
+        for (int fy = 0; fy < params->filter_height; fy++) {
+          const int oy = iy * params->stride_height - params->pad_height + fy;
+          if (oy < 0 || oy >= params->output_height) {
+            continue;
+          }
+          for (int fx = 0; fx < params->filter_width; fx++) {
+            const int ox = ix * params->stride_width - params->pad_width + fx;
+            if (ox < 0 || ox >= params->output_width) {
+              continue;
+            }
+            float16_t *sum = acc + (oy * params->output_width + ox) * out_ch;
+            for (int oc = 0; oc < out_ch; oc++) {
+              const int8_t *w = params->filter
+                                + ((oc * params->filter_height + fy) * params->filter_width + fx) * in_ch;
+              for (int ic = 0; ic < in_ch; ic++) {
+                const float16_t x = sli_mvp_ref_from_int(in[ic] + params->input_offset);
+                sum[oc] = sli_mvp_ref_mac(x, sli_mvp_ref_mul(sli_mvp_ref_from_int(w[ic]), scaler), sum[oc]);
+              }
+            }
+            macs += (uint32_t)(out_ch * in_ch);
+          }
+        }
+      }
+
+      sli_mvp_ref_program(sli_mvp_ref_instructions(macs));
+    }
+
+    for (int i = 0; i < output_size; i++) {
+      output[i] = sli_mvp_ref_to_int8(sli_mvp_ref_mul(acc[i], params->output_scaler[i % out_ch]),
+                                      params->output_offset,
+                                      params->output_activation_min,
+                                      params->output_activation_max);
+    }
+    sli_mvp_ref_program((uint32_t)output_size);
+  }
+
+  return SL_STATUS_OK;
+}
@@ -0,0 +1,175 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model driver and binary16 arithmetic.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <math.h>
+#include <string.h>
+
+#include "sl_mvp.h"
+#include "sli_mvp_reference.h"
+
+static sli_mvp_perfcnt_event_t perfcnt_event[SLI_MVP_PERFCNT_COUNT] = {
+  SLI_MVP_PERFCNT_RUN,
+  SLI_MVP_PERFCNT_STALL,
+};
+static uint32_t perfcnt[SLI_MVP_PERFCNT_COUNT];
+static uint32_t progcnt;
+
+sl_status_t sli_mvp_init(void)
+{
+  sli_mvp_perfcnt_reset_all();
+  sli_mvp_progcnt_reset();
+  return SL_STATUS_OK;
+}
+
+sl_status_t sli_mvp_deinit(void)
+{
+  return SL_STATUS_OK;
+}
+
+void sli_mvp_perfcnt_conf(unsigned counter, sli_mvp_perfcnt_event_t event)
+{
+  if (counter < SLI_MVP_PERFCNT_COUNT) {
+    perfcnt_event[counter] = event;
+    perfcnt[counter] = 0;
+  }
+}
+
+void sli_mvp_perfcnt_reset_all(void)
+{
+  memset(perfcnt, 0, sizeof(perfcnt));
+}
+
+uint32_t sli_mvp_perfcnt_get(unsigned counter)
+{
+  return counter < SLI_MVP_PERFCNT_COUNT ? perfcnt[counter] : 0;
+}
+
+void sli_mvp_progcnt_reset(void)
+{
+  progcnt = 0;
+}
+
+uint32_t sli_mvp_progcnt_get(void)
+{
+  return progcnt;
+}
+
+void sli_mvp_ref_program(uint32_t instructions)
+{
+  progcnt++;
+  for (unsigned i = 0; i < SLI_MVP_PERFCNT_COUNT; i++) {
+    switch (perfcnt_event[i]) {
+      case SLI_MVP_PERFCNT_RUN:
+        perfcnt[i] += instructions + SL_MVP_REFERENCE_PROGRAM_CYCLES;
+        break;
+      case SLI_MVP_PERFCNT_INSTRUCTIONS:
+        perfcnt[i] += instructions;
+        break;
+      case SLI_MVP_PERFCNT_STALL:
+      default:
+        // Memory contention is not modeled
+        break;
+    }
+  }
+}
+
+// Add two doubles rounding to odd, i.e. truncate and set the least significant
+// bit if the result is inexact. Rounding this result to binary16 gives the
+// correctly rounded sum, as a double has more than 2 bits of extra precision.
+static double add_round_to_odd(double a, double b)
+{
+  const double sum = a + b;
+  const double b_virtual = sum - a;
+  const double error = (a - (sum - b_virtual)) + (b - b_virtual);
+
+  if (error != 0.0) {
+    uint64_t bits;
+    memcpy(&bits, &sum, sizeof(bits));
+    if ((bits & 1U) == 0U) {
+      // The exact sum lies between sum and its neighbour towards error, one
+      // of which is odd.
+      return nextafter(sum, error > 0.0 ? INFINITY : -INFINITY);
+    }
+  }
+  return sum;
+}
+
+float16_t sli_mvp_ref_add(float16_t a, float16_t b)
+{
+  // The sum of two binary16 values is exact in double precision.
+  return (float16_t)((double)a + (double)b);
+}
+
+float16_t sli_mvp_ref_mul(float16_t a, float16_t b)
+{
+  // The product of two binary16 values is exact in double precision.
+  return (float16_t)((double)a * (double)b);
+}
+
+float16_t sli_mvp_ref_mac(float16_t a, float16_t b, float16_t c)
+{
+  return (float16_t)add_round_to_odd((double)a * (double)b, (double)c);
+}
+
+float16_t sli_mvp_ref_from_int(int32_t value)
+{
+  return (float16_t)(double)value;
+}
+
+float16_t sli_mvp_ref_from_float(float value)
+{
+  if (value > SLI_MVP_FP16_MAX) {
+    value = SLI_MVP_FP16_MAX;
+  } else if (value < SLI_MVP_FP16_MIN) {
+    value = SLI_MVP_FP16_MIN;
+  }
+  return (float16_t)value;
+}
+
+int8_t sli_mvp_ref_to_int8(float16_t value, int32_t offset, int32_t min, int32_t max)
+{
+  // Saturate infinities before converting to an integer, NaN converts to 0.
+  float f = (float)value;
+  if (f != f) {
+    f = 0.0f;
+  } else if (f > 32767.0f) {
+    f = 32767.0f;
+  } else if (f < -32768.0f) {
+    f = -32768.0f;
+  }
+
+  int32_t result = (int32_t)nearbyintf(f) + offset;
+  if (result < min) {
+    result = min;
+  } else if (result > max) {
+    result = max;
+  }
+  return (int8_t)result;
+}
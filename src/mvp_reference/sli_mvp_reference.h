@@ -0,0 +1,90 @@
+/***************************************************************************//**
+ * @file
+ * @brief MVP reference model internals.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SLI_MVP_REFERENCE_H
+#define SLI_MVP_REFERENCE_H
+
+#include "sl_mvp_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Number of binary16 lanes processed by one ALU instruction. Real valued
+// data is processed as pairs, i.e. as the real and imaginary parts of one
+// complex value. Only used for the instruction estimate, the kernels
+// accumulate every output sequentially rather than per lane.
+#ifndef SL_MVP_REFERENCE_LANES
+#define SL_MVP_REFERENCE_LANES            2
+#endif
+
+// Cycles spent loading and starting one program.
+#ifndef SL_MVP_REFERENCE_PROGRAM_CYCLES
+#define SL_MVP_REFERENCE_PROGRAM_CYCLES   40
+#endif
+
+// Instructions needed to process count values, SL_MVP_REFERENCE_LANES at a
+// time.
+static inline uint32_t sli_mvp_ref_instructions(uint32_t count)
+{
+  return (count + SL_MVP_REFERENCE_LANES - 1) / SL_MVP_REFERENCE_LANES;
+}
+
+// Account for one program executing the given number of instructions.
+void sli_mvp_ref_program(uint32_t instructions);
+
+// binary16 ALU operations, every result is rounded to nearest even.
+float16_t sli_mvp_ref_add(float16_t a, float16_t b);
+float16_t sli_mvp_ref_mul(float16_t a, float16_t b);
+// a * b + c, rounded once.
+float16_t sli_mvp_ref_mac(float16_t a, float16_t b, float16_t c);
+
+// Convert an integer to binary16, rounded to nearest even.
+float16_t sli_mvp_ref_from_int(int32_t value);
+
+// Convert a float to binary16, saturated to the finite binary16 range.
+float16_t sli_mvp_ref_from_float(float value);
+
+// Round a binary16 value to the nearest integer, ties to even, add offset and
+// clamp to [min, max].
+int8_t sli_mvp_ref_to_int8(float16_t value, int32_t offset, int32_t min, int32_t max);
+
+// Validate a loop or array dimension. The MVP array dimension limits are not
+// modeled, the callers split their loops over SLI_MVP_MAX_DIM_SIZE themselves.
+static inline bool sli_mvp_ref_dim_valid(int value)
+{
+  return value > 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SLI_MVP_REFERENCE_H
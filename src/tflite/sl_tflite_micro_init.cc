@@ -46,6 +46,7 @@
 #include "sl_tflite_micro_init.h"
 #include "sl_tflite_micro_config.h"
 #include "sl_tflite_micro_debug_log.h"
+#include "sl_tflite_micro_streaming.h"
 #include "tensorflow/lite/micro/tflite_bridge/micro_error_reporter.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
@@ -245,6 +246,12 @@ static void init(void)
 
   #endif
 
+  #if defined(SL_TFLITE_MICRO_STREAMING_ENABLE) && (SL_TFLITE_MICRO_STREAMING_ENABLE == 1)
+  // Streaming layers read input 0 of the model, which is the tensor the
+  // application updates through sl_tflite_micro_get_input_tensor()
+  sl_tflite_micro_streaming_register_input(model->subgraphs()->Get(0)->inputs()->Get(0));
+  #endif
+
   // Instantiate interpreter
   static tflite::MicroInterpreter static_interpreter(
     model, opcode_resolver, tensor_arena, arena_size);
@@ -0,0 +1,146 @@
+/***************************************************************************//**
+ * @file
+ * @brief Streaming inference support for TensorFlow Lite Micro.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include "sl_tflite_micro_streaming.h"
+#include "sl_tflite_micro_config.h"
+
+#ifndef SL_TFLITE_MICRO_STREAMING_MAX_TENSORS
+#define SL_TFLITE_MICRO_STREAMING_MAX_TENSORS (16)
+#endif
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+typedef struct {
+  const void *tensor;
+  uint32_t   sequence;
+  int        rows_shift;
+} streaming_tensor_t;
+
+// Incremented on every input update, sequence 0 is never valid.
+static uint32_t input_sequence = 1;
+static int input_tensor_index = -1;
+static bool input_valid = false;
+static size_t input_row_size = 0;
+static int input_num_rows = 0;
+static int input_new_rows = -1;
+
+static streaming_tensor_t tensors[SL_TFLITE_MICRO_STREAMING_MAX_TENSORS];
+static size_t next_tensor = 0;
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+void sl_tflite_micro_streaming_register_input(int tensor_index)
+{
+  input_tensor_index = tensor_index;
+  input_valid = false;
+}
+
+void sl_tflite_micro_streaming_input_update(size_t row_size,
+                                            int num_rows,
+                                            int new_rows)
+{
+  input_sequence++;
+  input_valid = true;
+  input_row_size = row_size;
+  input_num_rows = num_rows;
+  input_new_rows = (new_rows >= 0 && new_rows < num_rows) ? new_rows : -1;
+}
+
+void sl_tflite_micro_streaming_reset(void)
+{
+  // Skip a sequence number so that no layer sees the next input as a
+  // continuation of the previous one.
+  input_sequence += 2;
+  input_valid = false;
+  for (size_t i = 0; i < SL_TFLITE_MICRO_STREAMING_MAX_TENSORS; i++) {
+    tensors[i].tensor = NULL;
+  }
+  next_tensor = 0;
+}
+
+uint32_t sli_tflite_micro_streaming_get_sequence(void)
+{
+  return input_sequence;
+}
+
+bool sli_tflite_micro_streaming_is_input(int tensor_index)
+{
+  return input_tensor_index >= 0 && tensor_index == input_tensor_index;
+}
+
+int sli_tflite_micro_streaming_get_input_shift(size_t row_size,
+                                               int num_rows,
+                                               uint32_t last_sequence)
+{
+  if (!input_valid
+      || row_size != input_row_size || num_rows != input_num_rows) {
+    return -1;
+  }
+  if (last_sequence == input_sequence) {
+    // Invoked again without a new input
+    return 0;
+  }
+  if (last_sequence + 1 == input_sequence) {
+    return input_new_rows;
+  }
+  return -1;
+}
+
+bool sli_tflite_micro_streaming_get_tensor_shift(const void *tensor, int *rows_shift)
+{
+  for (size_t i = 0; i < SL_TFLITE_MICRO_STREAMING_MAX_TENSORS; i++) {
+    if (tensors[i].tensor == tensor) {
+      // Entries written during an earlier sequence are stale
+      *rows_shift = (tensors[i].sequence == input_sequence) ? tensors[i].rows_shift : -1;
+      return true;
+    }
+  }
+  return false;
+}
+
+void sli_tflite_micro_streaming_set_tensor_shift(const void *tensor, int rows_shift)
+{
+  size_t index = next_tensor;
+  for (size_t i = 0; i < SL_TFLITE_MICRO_STREAMING_MAX_TENSORS; i++) {
+    if (tensors[i].tensor == tensor) {
+      index = i;
+      break;
+    }
+  }
+  if (index == next_tensor) {
+    next_tensor = (next_tensor + 1) % SL_TFLITE_MICRO_STREAMING_MAX_TENSORS;
+  }
+  tensors[index].tensor = tensor;
+  tensors[index].sequence = input_sequence;
+  tensors[index].rows_shift = rows_shift;
+}
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Generate the real FFT coefficient tables of src/dsp/sl_ml_fft.cc.
+
+The CMSIS real FFT splits the output of a complex FFT of half the length
+with two coefficient tables. A table generated for the longest FFT also
+serves every shorter power of two length, by reading every (max_length /
+length)th coefficient. This tool writes the tables for each supported
+maximum length as const arrays, selected at build time by
+SL_ML_FFT_MAX_LENGTH, so that they stay in flash instead of being
+allocated and computed at boot.
+
+Longer maximum lengths use the 8192 point tables of the CMSIS DSP library.
+
+Example:
+  python3 generate_fft_tables.py ../../src/dsp/sl_ml_fft_tables.c
+"""
+
+import sys
+import math
+import argparse
+from pathlib import Path
+
+MAX_LENGTHS = (256, 512, 1024, 2048)
+VALUES_PER_LINE = 12
+
+HEADER = '''/***************************************************************************//**
+ * @file
+ * @brief SL_ML_FFT real coefficient tables
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Generated by tool/dsp/generate_fft_tables.py, do not edit.
+
+#include "sl_ml_fft_tables.h"
+
+'''
+
+
+def q15(value: float) -> int:
+  return max(-32768, min(32767, int(math.floor(value * 32768 + 0.5))))
+
+
+def real_coeff_tables(length: int):
+  '''
+  Coefficient tables A and B of a real FFT of the given length, interleaved
+  real and imaginary parts, as in the CMSIS realCoefAQ15 and realCoefBQ15.
+  '''
+  a = []
+  b = []
+  n = length // 2
+  for i in range(n):
+    angle = 2 * math.pi / (2 * n) * i
+    a += [q15(0.5 * (1.0 - math.sin(angle))), q15(0.5 * -math.cos(angle))]
+    b += [q15(0.5 * (1.0 + math.sin(angle))), q15(0.5 * math.cos(angle))]
+  return a, b
+
+
+def format_array(name: str, values) -> str:
+  lines = []
+  for i in range(0, len(values), VALUES_PER_LINE):
+    lines.append('  ' + ', '.join(str(v) for v in values[i:i + VALUES_PER_LINE]) + ',')
+  return f'const int16_t {name}[{len(values)}] = {{\n' + '\n'.join(lines) + '\n};\n'
+
+
+def generate() -> str:
+  source = HEADER
+  for index, length in enumerate(MAX_LENGTHS):
+    a, b = real_coeff_tables(length)
+    source += ('#if' if index == 0 else '#elif') + f' SL_ML_FFT_MAX_LENGTH == {length}\n\n'
+    source += format_array('sli_ml_fft_real_coeff_a', a) + '\n'
+    source += format_array('sli_ml_fft_real_coeff_b', b) + '\n'
+  source += '#endif\n'
+  return source
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Generate the real FFT coefficient tables')
+  parser.add_argument('output', type=Path, help='Output C source file')
+  args = parser.parse_args()
+
+  args.output.write_text(generate())
+  print(f'Tables for maximum lengths {", ".join(str(l) for l in MAX_LENGTHS)} written to {args.output}')
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,362 @@
+#!/usr/bin/env python3
+"""
+Generate the precomputed tables of an audio frontend configuration.
+
+FrontendPopulateState allocates the window, filterbank, PCAN and DCT tables
+on the heap, and computes them with float math at boot. This tool computes
+the same tables on the host, with the same single and double precision
+steps as microfrontend/lib, and writes them as const C arrays of a
+struct FrontendTables. FrontendPopulateStateFromTables then references the
+arrays in place, in flash, and only allocates the buffers written while
+processing audio.
+
+The tables only depend on the options below. The remaining settings, like
+the window step, the noise reduction smoothing or the log scale, are still
+taken from the configuration at runtime. FrontendPopulateStateFromTables
+fails if the configuration does not match the tables.
+
+Example:
+  python3 generate_frontend_tables.py --sample-rate 16000 --window-size-ms 30 \\
+    --channels 40 --lower-band-limit 125 --upper-band-limit 7500 --name kws_frontend_tables \\
+    kws_frontend_tables
+"""
+
+import sys
+import math
+import argparse
+from pathlib import Path
+
+import numpy as np
+
+F32 = np.float32
+
+# Constants of microfrontend/lib
+FRONTEND_WINDOW_BITS = 12
+FILTERBANK_BITS = 12
+FILTERBANK_INDEX_ALIGNMENT = 2
+FILTERBANK_CHANNEL_BLOCK_SIZE = 4
+WIDE_DYNAMIC_FUNCTION_BITS = 32
+WIDE_DYNAMIC_FUNCTION_LUT_SIZE = 4 * WIDE_DYNAMIC_FUNCTION_BITS - 3
+DCT_COSINE_BITS = 15
+INT16_MAX = 32767
+
+VALUES_PER_LINE = 12
+
+HEADER = '''/***************************************************************************//**
+ * @file
+ * @brief Precomputed audio frontend tables
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Generated by tool/frontend/generate_frontend_tables.py, do not edit.
+'''
+
+
+def fft_size(window_size: int) -> int:
+  '''
+  FFT size of sli_ml_fft_init.
+  '''
+  size = 32
+  while size < window_size:
+    size <<= 1
+  return size
+
+
+def window_coefficients(size: int):
+  arg = F32(math.pi * 2.0 / float(F32(size)))
+  coefficients = []
+  for i in range(size):
+    cosine = np.cos(F32(float(arg) * (i + 0.5)))
+    value = F32(0.5 - 0.5 * float(cosine))
+    coefficients.append(int(math.floor(float(value * F32(1 << FRONTEND_WINDOW_BITS)) + 0.5)))
+  return coefficients
+
+
+def freq_to_mel(freq) -> np.float32:
+  return F32(1127.0 * math.log1p(float(freq) / 700.0))
+
+
+def filterbank_tables(num_channels: int, lower_band_limit: float, upper_band_limit: float,
+                      sample_rate: int, spectrum_size: int):
+  '''
+  Same steps as FilterbankPopulateState.
+  '''
+  lower_band_limit = F32(lower_band_limit)
+  upper_band_limit = F32(upper_band_limit)
+  num_channels_plus_1 = num_channels + 1
+
+  mel_low = freq_to_mel(lower_band_limit)
+  mel_hi = freq_to_mel(upper_band_limit)
+  mel_span = F32(mel_hi - mel_low)
+  mel_spacing = F32(mel_span / F32(num_channels_plus_1))
+  center_mel_freqs = [F32(mel_low + F32(mel_spacing * F32(i + 1))) for i in range(num_channels_plus_1)]
+
+  hz_per_sbin = F32(0.5 * sample_rate / (float(F32(spectrum_size)) - 1))
+  start_index = int(1.5 + float(F32(lower_band_limit / hz_per_sbin)))
+  end_index = 0
+
+  frequency_starts = [0] * num_channels_plus_1
+  weight_starts = [0] * num_channels_plus_1
+  widths = [0] * num_channels_plus_1
+  actual_starts = [0] * num_channels_plus_1
+  actual_widths = [0] * num_channels_plus_1
+
+  chan_freq_index_start = start_index
+  weight_index_start = 0
+  needs_zeros = False
+  for chan in range(num_channels_plus_1):
+    freq_index = chan_freq_index_start
+    while freq_to_mel(F32(F32(freq_index) * hz_per_sbin)) <= center_mel_freqs[chan]:
+      freq_index += 1
+
+    width = freq_index - chan_freq_index_start
+    actual_starts[chan] = chan_freq_index_start
+    actual_widths[chan] = width
+
+    if width == 0:
+      frequency_starts[chan] = 0
+      weight_starts[chan] = 0
+      widths[chan] = FILTERBANK_CHANNEL_BLOCK_SIZE
+      if not needs_zeros:
+        needs_zeros = True
+        for j in range(chan):
+          weight_starts[j] += FILTERBANK_CHANNEL_BLOCK_SIZE
+        weight_index_start += FILTERBANK_CHANNEL_BLOCK_SIZE
+    else:
+      aligned_start = (chan_freq_index_start // FILTERBANK_INDEX_ALIGNMENT) * FILTERBANK_INDEX_ALIGNMENT
+      aligned_width = chan_freq_index_start - aligned_start + width
+      padded_width = ((aligned_width - 1) // FILTERBANK_CHANNEL_BLOCK_SIZE + 1) * FILTERBANK_CHANNEL_BLOCK_SIZE
+      frequency_starts[chan] = aligned_start
+      weight_starts[chan] = weight_index_start
+      widths[chan] = padded_width
+      weight_index_start += padded_width
+    chan_freq_index_start = freq_index
+
+  weights = [0] * weight_index_start
+  unweights = [0] * weight_index_start
+  for chan in range(num_channels_plus_1):
+    frequency = actual_starts[chan]
+    frequency_offset = frequency - frequency_starts[chan]
+    denom_val = mel_low if chan == 0 else center_mel_freqs[chan - 1]
+    for j in range(actual_widths[chan]):
+      mel = freq_to_mel(F32(F32(frequency) * hz_per_sbin))
+      weight = F32(F32(center_mel_freqs[chan] - mel) / F32(center_mel_freqs[chan] - denom_val))
+      index = weight_starts[chan] + frequency_offset + j
+      weights[index] = int(math.floor(float(weight * F32(1 << FILTERBANK_BITS)) + 0.5))
+      unweights[index] = int(math.floor((1.0 - float(weight)) * (1 << FILTERBANK_BITS) + 0.5))
+      frequency += 1
+    end_index = max(end_index, frequency)
+
+  if end_index > spectrum_size:
+    raise ValueError('Filterbank end index is above the spectrum size')
+
+  return {
+    'start_index': start_index,
+    'end_index': end_index,
+    'frequency_starts': frequency_starts,
+    'weight_starts': weight_starts,
+    'widths': widths,
+    'weights': weights,
+    'unweights': unweights,
+  }
+
+
+def pcan_gain_lookup(strength: float, offset: float, gain_bits: int, input_bits: int, x: int) -> int:
+  x_as_float = F32(F32(x) / F32((1 << input_bits) & 0xFFFFFFFF))
+  power = F32(np.power(F32(x_as_float + F32(offset)), F32(-F32(strength))))
+  gain = F32(F32((1 << gain_bits) & 0xFFFFFFFF) * power)
+  if gain > INT16_MAX:
+    return INT16_MAX
+  return int(F32(gain + F32(0.5)))
+
+
+def pcan_gain_lut(strength: float, offset: float, gain_bits: int, smoothing_bits: int,
+                  input_correction_bits: int):
+  '''
+  Same steps as PcanGainControlPopulateState. The unused fourth entries of
+  every interval are zero.
+  '''
+  input_bits = smoothing_bits - input_correction_bits
+  def lookup(x):
+    return pcan_gain_lookup(strength, offset, gain_bits, input_bits, x)
+
+  lut = [0] * WIDE_DYNAMIC_FUNCTION_LUT_SIZE
+  lut[0] = lookup(0)
+  lut[1] = lookup(1)
+  for interval in range(2, WIDE_DYNAMIC_FUNCTION_BITS + 1):
+    x0 = 1 << (interval - 1)
+    x1 = x0 + (x0 >> 1)
+    x2 = x0 + (x0 - 1) if interval == WIDE_DYNAMIC_FUNCTION_BITS else 2 * x0
+    y0 = lookup(x0)
+    y1 = lookup(x1)
+    y2 = lookup(x2)
+    diff1 = y1 - y0
+    diff2 = y2 - y0
+    a1 = 4 * diff1 - diff2
+    a2 = diff2 - a1
+    base = 4 * interval - 6
+    lut[base] = y0
+    lut[base + 1] = int(np.int16(a1))
+    lut[base + 2] = int(np.int16(a2))
+  return lut
+
+
+def dct_cosines(num_coefficients: int, num_channels: int):
+  '''
+  Same steps as DctPopulateState.
+  '''
+  pi = F32(3.14159265358979)
+  cosines = []
+  for k in range(num_coefficients):
+    scale = F32(np.sqrt(F32(F32(1.0 if k == 0 else 2.0) / F32(num_channels))))
+    for n in range(num_channels):
+      angle = F32(F32(F32(pi * F32(n + 0.5)) * F32(k)) / F32(num_channels))
+      value = F32(F32(scale * np.cos(angle)) * F32(1 << DCT_COSINE_BITS))
+      cosines.append(INT16_MAX if value >= INT16_MAX else int(math.floor(float(F32(value + F32(0.5))))))
+  return cosines
+
+
+def format_array(c_type: str, name: str, values) -> str:
+  lines = []
+  for i in range(0, len(values), VALUES_PER_LINE):
+    lines.append('  ' + ', '.join(str(v) for v in values[i:i + VALUES_PER_LINE]) + ',')
+  return f'static const {c_type} {name}[{len(values)}] = {{\n' + '\n'.join(lines) + '\n};\n\n'
+
+
+def generate(args, name: str, file_name: str):
+  window_size = args.window_size_ms * args.sample_rate // 1000
+  size = fft_size(window_size)
+  if window_size < 16 or window_size > 8192:
+    raise ValueError('The window must have 16 to 8192 samples')
+  input_correction_bits = size.bit_length() - 1 - (FILTERBANK_BITS // 2)
+  filterbank = filterbank_tables(args.channels, args.lower_band_limit, args.upper_band_limit,
+                                 args.sample_rate, size // 2 + 1)
+  if args.dct_coefficients > args.channels:
+    raise ValueError('The number of DCT coefficients must be at most the number of channels')
+
+  source = HEADER + f'\n#include "{file_name}.h"\n\n'
+  source += format_array('int16_t', 'window_coefficients', window_coefficients(window_size))
+  source += format_array('int16_t', 'channel_frequency_starts', filterbank['frequency_starts'])
+  source += format_array('int16_t', 'channel_weight_starts', filterbank['weight_starts'])
+  source += format_array('int16_t', 'channel_widths', filterbank['widths'])
+  source += format_array('int16_t', 'weights', filterbank['weights'])
+  source += format_array('int16_t', 'unweights', filterbank['unweights'])
+  if args.pcan:
+    source += format_array('int16_t', 'pcan_gain_lut',
+                           pcan_gain_lut(args.pcan_strength, args.pcan_offset, args.pcan_gain_bits,
+                                         args.noise_smoothing_bits, input_correction_bits))
+  if args.dct_coefficients > 0:
+    source += format_array('int16_t', 'dct_cosines', dct_cosines(args.dct_coefficients, args.channels))
+
+  fields = [
+    ('sample_rate', args.sample_rate),
+    ('window_size_ms', args.window_size_ms),
+    ('num_channels', args.channels),
+    ('lower_band_limit', repr(args.lower_band_limit)),
+    ('upper_band_limit', repr(args.upper_band_limit)),
+    ('enable_pcan', int(args.pcan)),
+    ('pcan_strength', repr(args.pcan_strength)),
+    ('pcan_offset', repr(args.pcan_offset)),
+    ('pcan_gain_bits', args.pcan_gain_bits),
+    ('noise_reduction_smoothing_bits', args.noise_smoothing_bits),
+    ('num_dct_coefficients', args.dct_coefficients),
+    ('window_size', window_size),
+    ('fft_size', size),
+    ('window_coefficients', 'window_coefficients'),
+    ('filterbank_start_index', filterbank['start_index']),
+    ('filterbank_end_index', filterbank['end_index']),
+    ('channel_frequency_starts', 'channel_frequency_starts'),
+    ('channel_weight_starts', 'channel_weight_starts'),
+    ('channel_widths', 'channel_widths'),
+    ('weights', 'weights'),
+    ('unweights', 'unweights'),
+    ('pcan_gain_lut', 'pcan_gain_lut' if args.pcan else 'NULL'),
+    ('dct_cosines', 'dct_cosines' if args.dct_coefficients > 0 else 'NULL'),
+  ]
+  source += f'const struct FrontendTables {name} = {{\n'
+  source += ''.join(f'  .{field} = {value},\n' for field, value in fields)
+  source += '};\n'
+
+  guard = ''.join(c if c.isalnum() else '_' for c in file_name).upper() + '_H'
+  header = HEADER + f'''
+#ifndef {guard}
+#define {guard}
+
+#include "microfrontend/lib/frontend_tables.h"
+
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+extern const struct FrontendTables {name};
+
+#ifdef __cplusplus
+}}  // extern "C"
+#endif
+
+#endif // {guard}
+'''
+  table_bytes = 2 * window_size + 2 * 3 * (args.channels + 1) + 4 * len(filterbank['weights'])
+  table_bytes += 2 * WIDE_DYNAMIC_FUNCTION_LUT_SIZE if args.pcan else 0
+  table_bytes += 2 * args.dct_coefficients * args.channels
+  return header, source, table_bytes
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Generate the precomputed tables of an audio frontend configuration')
+  parser.add_argument('output', type=Path, help='Output path without extension, a .h and a .c file are written')
+  parser.add_argument('--name', default='sl_ml_frontend_tables',
+                      help='Name of the struct FrontendTables variable (default: sl_ml_frontend_tables)')
+  parser.add_argument('--sample-rate', type=int, default=16000, help='Sample rate in Hz (default: 16000)')
+  parser.add_argument('--window-size-ms', type=int, default=25, help='Window size in milliseconds (default: 25)')
+  parser.add_argument('--channels', type=int, default=32, help='Number of filterbank channels (default: 32)')
+  parser.add_argument('--lower-band-limit', type=float, default=125.0, help='Filterbank lower band limit in Hz (default: 125)')
+  parser.add_argument('--upper-band-limit', type=float, default=7500.0, help='Filterbank upper band limit in Hz (default: 7500)')
+  parser.add_argument('--pcan', action='store_true', help='Generate the PCAN gain control table')
+  parser.add_argument('--pcan-strength', type=float, default=0.95, help='PCAN strength (default: 0.95)')
+  parser.add_argument('--pcan-offset', type=float, default=80.0, help='PCAN offset (default: 80)')
+  parser.add_argument('--pcan-gain-bits', type=int, default=21, help='PCAN gain bits (default: 21)')
+  parser.add_argument('--noise-smoothing-bits', type=int, default=10, help='Noise reduction smoothing bits, used by PCAN (default: 10)')
+  parser.add_argument('--dct-coefficients', type=int, default=0, help='Number of DCT coefficients, 0 when the DCT is disabled (default: 0)')
+  args = parser.parse_args()
+
+  if not args.name.isidentifier():
+    print(f'{args.name} is not a valid C identifier')
+    return 1
+  try:
+    header, source, table_bytes = generate(args, args.name, args.output.name)
+  except ValueError as e:
+    print(e)
+    return 1
+  args.output.parent.joinpath(args.output.name + '.h').write_text(header)
+  args.output.parent.joinpath(args.output.name + '.c').write_text(source)
+  print(f'{args.name}: {table_bytes} bytes of tables written to {args.output}.h and {args.output}.c')
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
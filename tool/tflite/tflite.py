@@ -172,6 +172,7 @@ opcode_dict = {
     BuiltinOperator.TANH: 'AddTanh',
     BuiltinOperator.TRANSPOSE: 'AddTranspose',
     BuiltinOperator.TRANSPOSE_CONV: 'AddTransposeConv',
+    BuiltinOperator.UNIDIRECTIONAL_SEQUENCE_LSTM: 'AddUnidirectionalSequenceLSTM',
     BuiltinOperator.UNPACK: 'AddUnpack',
     BuiltinOperator.VAR_HANDLE: 'AddVarHandle',
     BuiltinOperator.WHILE: 'AddWhile',
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""
+Convert the pruned weights of FULLY_CONNECTED layers in a quantized .tflite
+model to a block sparse format.
+
+The weights are split in blocks of block_rows x block_cols, blocks containing
+only zeros are dropped. The converted tensors are stored as one dimensional
+uint8 tensors holding the buffer, so that the tensor size is the size of the
+buffer, with the original quantization parameters. The buffer holds:
+
+  magic "SLBS" | block_rows (u8) | block_cols (u8) | reserved (u16)
+  nonzero_blocks (u32) | units (i32) | depth (i32)
+  block_ptr (u16 LE) for every row of blocks, plus the total block count
+  block_index (u16 LE), the column of every nonzero block in units of block_cols
+  the int8 weights of every row of blocks, stored as a dense
+  [block_rows, nonzero blocks in the row * block_cols] matrix
+
+The resulting model requires the MVP accelerated kernels, which skip the zero
+blocks on both the MVP and the CMSIS-NN paths.
+
+Example:
+  python3 tflite_block_sparse.py model.tflite model_sparse.tflite --block-rows 16 --block-cols 16
+"""
+
+import sys
+import argparse
+import struct
+from pathlib import Path
+
+import numpy as np
+
+from tflite_model import TfliteModel
+from tflite_model.tflite_model import _tflite_schema_fb
+from tensorflow_lite_support.metadata.schema_py_generated import BuiltinOperator, TensorType
+
+BLOCK_SPARSE_MAGIC = b'SLBS'
+BLOCK_SPARSE_HEADER = struct.Struct('<4sBBHIii')
+
+
+def get_builtin_code(model, operator):
+  opcode = model.operatorCodes[operator.opcodeIndex]
+  return max(opcode.builtinCode, opcode.deprecatedBuiltinCode)
+
+
+def block_sparse_weights(weights: np.ndarray, block_rows: int, block_cols: int) -> bytes:
+  '''
+  Return the block sparse buffer of a [units, depth] int8 weight array, or
+  None if the shape is not a multiple of the block size.
+  '''
+  units, depth = weights.shape
+  if units % block_rows or depth % block_cols:
+    return None
+
+  row_blocks = units // block_rows
+  col_blocks = depth // block_cols
+  blocks = weights.reshape(row_blocks, block_rows, col_blocks, block_cols)
+  nonzero = np.any(blocks != 0, axis=(1, 3))
+
+  if nonzero.sum() > 0xFFFF or col_blocks > 0xFFFF:
+    # More blocks than a uint16 index can address
+    return None
+
+  block_ptr = np.concatenate(([0], np.cumsum(nonzero.sum(axis=1)))).astype('<u2')
+  block_index = np.concatenate([np.flatnonzero(row) for row in nonzero]).astype('<u2')
+
+  values = bytearray()
+  for r in range(row_blocks):
+    columns = np.flatnonzero(nonzero[r])
+    values += blocks[r][:, columns, :].reshape(block_rows, -1).astype(np.int8).tobytes()
+
+  header = BLOCK_SPARSE_HEADER.pack(BLOCK_SPARSE_MAGIC, block_rows, block_cols, 0, int(nonzero.sum()),
+                                    units, depth)
+  return header + block_ptr.tobytes() + block_index.tobytes() + bytes(values)
+
+
+def sparsify_model(model: TfliteModel, block_rows: int, block_cols: int) -> int:
+  '''
+  Convert all eligible weight tensors of the model, returns the number of
+  bytes saved.
+  '''
+  model_t = _tflite_schema_fb.ModelT.InitFromObj(model.flatbuffer_model)
+  subgraph = model_t.subgraphs[0]
+
+  # Weights shared with other layers are left as is
+  users = {}
+  for operator in subgraph.operators:
+    for index in operator.inputs:
+      users.setdefault(index, set()).add(get_builtin_code(model_t, operator))
+
+  saved = 0
+  for operator in subgraph.operators:
+    if get_builtin_code(model_t, operator) != BuiltinOperator.FULLY_CONNECTED:
+      continue
+
+    index = operator.inputs[1]
+    tensor = subgraph.tensors[index]
+    if tensor.type != TensorType.INT8 or len(tensor.shape) != 2 \
+       or users[index] != {BuiltinOperator.FULLY_CONNECTED}:
+      continue
+
+    zero_point = tensor.quantization.zeroPoint if tensor.quantization else None
+    if zero_point is not None and np.any(np.asarray(zero_point) != 0):
+      continue
+
+    buffer = model_t.buffers[tensor.buffer]
+    if buffer.data is None or len(buffer.data) == 0:
+      continue
+
+    weights = np.frombuffer(bytes(bytearray(buffer.data)), dtype=np.int8).reshape(tensor.shape)
+    data = block_sparse_weights(weights, block_rows, block_cols)
+    name = tensor.name.decode('utf-8') if isinstance(tensor.name, bytes) else tensor.name
+    if data is None or len(data) >= weights.size:
+      print(f'fully_connected {name}: skipped')
+      continue
+
+    density = (len(data) - BLOCK_SPARSE_HEADER.size) / weights.size
+    print(f'fully_connected {name}: {weights.size} -> {len(data)} bytes ({density:.0%})')
+    saved += weights.size - len(data)
+    buffer.data = np.frombuffer(data, dtype=np.uint8)
+    tensor.type = TensorType.UINT8
+    tensor.shape = np.array([len(data)], dtype=np.int32)
+    if tensor.shapeSignature is not None:
+      tensor.shapeSignature = np.array([len(data)], dtype=np.int32)
+
+  model._update_model(model_t)
+  return saved
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Convert pruned fully connected weights of a .tflite model to a block sparse format')
+  parser.add_argument('input', type=Path, help='Input .tflite model')
+  parser.add_argument('output', type=Path, help='Output .tflite model')
+  parser.add_argument('--block-rows', type=int, default=16, help='Output units per block (default: 16)')
+  parser.add_argument('--block-cols', type=int, default=16, help='Input values per block (default: 16)')
+  args = parser.parse_args()
+
+  if not (1 <= args.block_rows <= 255 and 1 <= args.block_cols <= 255):
+    parser.error('block dimensions must be between 1 and 255')
+
+  model = TfliteModel.load_flatbuffer_file(str(args.input))
+  saved = sparsify_model(model, args.block_rows, args.block_cols)
+  model.save(str(args.output))
+  print(f'Saved {saved} bytes, model size {model.flatbuffer_size} bytes')
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""
+Add an offline memory plan to a .tflite model in which elementwise layers
+run in place.
+
+The TensorFlow Lite Micro memory planner gives every output its own arena
+buffer. The output of an ADD or MUL layer can instead reuse the buffer of an
+input of the same size, when that layer is the last user of the input.
+Aliasing lowers the peak arena usage of residual networks, where the ADD
+output otherwise needs a buffer next to both of its inputs.
+
+Aliasing is safe because the ADD and MUL kernels in src/kernels/mvp1 write
+every output element after reading the input elements at the same index, on
+the MVP and on the CPU. Only these kernels have been checked, other
+elementwise layers (SUB, QUANTIZE, activations) always get their own output
+buffer.
+
+The plan places all non-constant tensors, aliased tensors share an offset.
+It is stored in the "OfflineMemoryAllocation" metadata of the model, which
+the interpreter uses instead of planning the tensors itself:
+
+  version (0) | subgraph (0) | number of tensors | offset of every tensor
+
+with int32 little endian values, the offset is -1 for tensors that are not
+planned. Model inputs and outputs, and variable tensors, are never aliased.
+Scratch buffers are still planned by the interpreter, around the offline
+planned tensors.
+
+Example:
+  python3 tflite_inplace_plan.py model.tflite model_inplace.tflite
+"""
+
+import sys
+import argparse
+from pathlib import Path
+
+import numpy as np
+
+from tflite_model import TfliteModel
+from tflite_model.tflite_model import _tflite_schema_fb
+from tensorflow_lite_support.metadata.schema_py_generated import BuiltinOperator, TensorType
+
+OFFLINE_PLAN_METADATA = 'OfflineMemoryAllocation'
+
+# Arena buffers are aligned to 16 bytes by the interpreter.
+BUFFER_ALIGNMENT = 16
+
+INPLACE_OPS = {
+  BuiltinOperator.ADD: 'add',
+  BuiltinOperator.MUL: 'mul',
+}
+
+TYPE_SIZES = {
+  TensorType.FLOAT32: 4,
+  TensorType.FLOAT16: 2,
+  TensorType.INT32: 4,
+  TensorType.UINT8: 1,
+  TensorType.INT64: 8,
+  TensorType.BOOL: 1,
+  TensorType.INT16: 2,
+  TensorType.INT8: 1,
+}
+
+
+def get_builtin_code(model, operator):
+  opcode = model.operatorCodes[operator.opcodeIndex]
+  return max(opcode.builtinCode, opcode.deprecatedBuiltinCode)
+
+
+def tensor_bytes(tensor) -> int:
+  size = TYPE_SIZES[tensor.type] * int(np.prod(tensor.shape if tensor.shape is not None else []))
+  return -(-size // BUFFER_ALIGNMENT) * BUFFER_ALIGNMENT
+
+
+def place_buffers(buffers):
+  '''
+  Greedy placement of (size, first_use, last_use) buffers, largest first.
+  Returns the offsets and the arena size.
+  '''
+  order = sorted(range(len(buffers)), key=lambda i: (-buffers[i][0], buffers[i][1]))
+  offsets = [None] * len(buffers)
+  placed = []
+  for i in order:
+    size, first, last = buffers[i]
+    live = sorted((offsets[j], buffers[j][0]) for j in placed
+                  if buffers[j][1] <= last and first <= buffers[j][2])
+    offset = 0
+    for live_offset, live_size in live:
+      if offset + size <= live_offset:
+        break
+      offset = max(offset, live_offset + live_size)
+    offsets[i] = offset
+    placed.append(i)
+  arena = max((offsets[i] + buffers[i][0] for i in range(len(buffers))), default=0)
+  return offsets, arena
+
+
+def plan_model(model: TfliteModel, inplace: bool = True):
+  '''
+  Return the per tensor offsets, the arena size of the planned tensors, and
+  a list of (layer index, op name, input tensor, output tensor) aliases.
+  '''
+  model_t = _tflite_schema_fb.ModelT.InitFromObj(model.flatbuffer_model)
+  subgraph = model_t.subgraphs[0]
+  n_tensors = len(subgraph.tensors)
+  n_layers = len(subgraph.operators)
+
+  graph_inputs = set(int(i) for i in subgraph.inputs)
+  graph_outputs = set(int(i) for i in subgraph.outputs)
+
+  def is_planned(index):
+    tensor = subgraph.tensors[index]
+    buffer = model_t.buffers[tensor.buffer]
+    has_data = buffer.data is not None and len(buffer.data) > 0
+    return not has_data and not tensor.isVariable and tensor.type in TYPE_SIZES
+
+  # Lifetime of every planned tensor in layer indices.
+  first_use = {}
+  last_use = {}
+  for index in graph_inputs:
+    first_use[index] = 0
+  for layer_index, operator in enumerate(subgraph.operators):
+    for index in operator.outputs:
+      first_use.setdefault(int(index), layer_index)
+    for index in operator.inputs:
+      if index >= 0:
+        last_use[int(index)] = layer_index
+  for index in graph_outputs:
+    last_use[index] = n_layers - 1
+
+  planned = [i for i in range(n_tensors) if is_planned(i) and i in first_use]
+  for index in planned:
+    last_use.setdefault(index, first_use[index])
+
+  # Aliased tensors are merged into the group of the input they replace.
+  group = {index: index for index in planned}
+  aliases = []
+  for layer_index, operator in enumerate(subgraph.operators):
+    builtin_code = get_builtin_code(model_t, operator)
+    if not inplace or builtin_code not in INPLACE_OPS or len(operator.outputs) != 1:
+      continue
+    output_index = int(operator.outputs[0])
+    if output_index not in group or output_index in graph_outputs:
+      continue
+    output = subgraph.tensors[output_index]
+    for input_index in operator.inputs:
+      input_index = int(input_index)
+      if input_index not in group or input_index in graph_inputs or input_index in graph_outputs:
+        continue
+      tensor = subgraph.tensors[input_index]
+      if last_use[input_index] != layer_index \
+         or tensor_bytes(tensor) != tensor_bytes(output) \
+         or TYPE_SIZES[tensor.type] != TYPE_SIZES[output.type] \
+         or list(tensor.shape) != list(output.shape):
+        continue
+      group[output_index] = group[input_index]
+      aliases.append((layer_index, INPLACE_OPS[builtin_code], input_index, output_index))
+      break
+
+  roots = sorted(set(group.values()))
+  buffers = []
+  for root in roots:
+    members = [i for i in planned if group[i] == root]
+    buffers.append((max(tensor_bytes(subgraph.tensors[i]) for i in members),
+                    min(first_use[i] for i in members),
+                    max(last_use[i] for i in members)))
+  root_offsets, arena = place_buffers(buffers)
+
+  offsets = [-1] * n_tensors
+  for root, offset in zip(roots, root_offsets):
+    for index in planned:
+      if group[index] == root:
+        offsets[index] = offset
+  return offsets, arena, aliases
+
+
+def offline_plan_metadata(offsets) -> bytes:
+  return np.array([0, 0, len(offsets)] + list(offsets), dtype='<i4').tobytes()
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Add an offline memory plan running elementwise layers in place to a .tflite model')
+  parser.add_argument('input', type=Path, help='Input .tflite model')
+  parser.add_argument('output', type=Path, help='Output .tflite model')
+  args = parser.parse_args()
+
+  model = TfliteModel.load_flatbuffer_file(str(args.input))
+  _, separate_arena, _ = plan_model(model, inplace=False)
+  offsets, arena, aliases = plan_model(model)
+
+  for layer_index, op, input_index, output_index in aliases:
+    print(f'layer {layer_index} {op}: tensor {output_index} in place of tensor {input_index}')
+  if not aliases:
+    print('No layer can run in place, no model written')
+    return 0
+
+  model.add_metadata(OFFLINE_PLAN_METADATA, offline_plan_metadata(offsets))
+  model.save(str(args.output))
+  print(f'Planned tensors: {separate_arena} -> {arena} bytes')
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+Palettize the weights of a quantized .tflite model.
+
+Weight clustering during training leaves only a few unique values in the int8
+weight tensors of FULLY_CONNECTED and CONV_2D layers. This script replaces
+each of those tensors with a per-layer codebook of the unique values and the
+codebook indices packed with the minimum number of bits per weight.
+
+The palettized tensors are stored as one dimensional uint8 tensors holding the
+buffer, so that the tensor size is the size of the buffer, with the original
+quantization parameters. The buffer holds:
+
+  magic "SLCB" | index_bits (u8) | dims_count (u8) | codebook_size (u16, LE)
+  dims (4 x i32 LE), the original shape padded with zeros
+  codebook_size int8 values
+  indices, packed LSB first with index_bits bits per weight
+
+The resulting model requires the MVP accelerated kernels, which decompress the
+weights to int8 tile by tile at inference time.
+
+Example:
+  python3 tflite_palettize.py model.tflite model_palettized.tflite --max-values 32
+"""
+
+import sys
+import argparse
+import struct
+from pathlib import Path
+
+import numpy as np
+
+from tflite_model import TfliteModel
+from tflite_model.tflite_model import _tflite_schema_fb
+from tensorflow_lite_support.metadata.schema_py_generated import BuiltinOperator, TensorType
+
+CODEBOOK_MAGIC = b'SLCB'
+CODEBOOK_HEADER = struct.Struct('<4sBBH4i')
+MAX_DIMS = 4
+
+# Layers which accept palettized weights as their second input.
+SUPPORTED_OPS = {
+  BuiltinOperator.CONV_2D: 'conv_2d',
+  BuiltinOperator.FULLY_CONNECTED: 'fully_connected',
+}
+
+
+def get_builtin_code(model, operator):
+  opcode = model.operatorCodes[operator.opcodeIndex]
+  return max(opcode.builtinCode, opcode.deprecatedBuiltinCode)
+
+
+def pack_indices(indices: np.ndarray, bits: int) -> bytes:
+  bitstream = (indices[:, None] >> np.arange(bits)) & 1
+  return np.packbits(bitstream.astype(np.uint8).reshape(-1), bitorder='little').tobytes()
+
+
+def palettize_weights(weights: np.ndarray, max_values: int) -> bytes:
+  '''
+  Return the palettized buffer of an int8 weight array, or None if the weights
+  have more than max_values unique values or more than MAX_DIMS dimensions.
+  '''
+  if not 1 <= weights.ndim <= MAX_DIMS:
+    return None
+  codebook, indices = np.unique(weights.reshape(-1), return_inverse=True)
+  if len(codebook) > max_values:
+    return None
+
+  bits = max(1, int(np.ceil(np.log2(len(codebook)))))
+  dims = list(weights.shape) + [0] * (MAX_DIMS - weights.ndim)
+  header = CODEBOOK_HEADER.pack(CODEBOOK_MAGIC, bits, weights.ndim, len(codebook), *dims)
+  return header + codebook.astype(np.int8).tobytes() + pack_indices(indices.astype(np.uint32), bits)
+
+
+def palettize_model(model: TfliteModel, max_values: int) -> int:
+  '''
+  Palettize all eligible weight tensors of the model, returns the number of
+  bytes saved.
+  '''
+  model_t = _tflite_schema_fb.ModelT.InitFromObj(model.flatbuffer_model)
+  subgraph = model_t.subgraphs[0]
+
+  # Weights shared with layers which do not support palettization are left as is
+  users = {}
+  for operator in subgraph.operators:
+    for index in operator.inputs:
+      users.setdefault(index, set()).add(get_builtin_code(model_t, operator))
+
+  saved = 0
+  for operator in subgraph.operators:
+    builtin_code = get_builtin_code(model_t, operator)
+    if builtin_code not in SUPPORTED_OPS or len(operator.inputs) < 2:
+      continue
+
+    index = operator.inputs[1]
+    tensor = subgraph.tensors[index]
+    if tensor.type != TensorType.INT8 or not users[index] <= SUPPORTED_OPS.keys():
+      continue
+
+    buffer = model_t.buffers[tensor.buffer]
+    if buffer.data is None or len(buffer.data) == 0:
+      continue
+
+    weights = np.frombuffer(bytes(bytearray(buffer.data)), dtype=np.int8).reshape(tensor.shape)
+    data = palettize_weights(weights, max_values)
+    name = tensor.name.decode('utf-8') if isinstance(tensor.name, bytes) else tensor.name
+    if data is None or len(data) >= weights.size:
+      print(f'{SUPPORTED_OPS[builtin_code]} {name}: {len(np.unique(weights))} unique values, skipped')
+      continue
+
+    print(f'{SUPPORTED_OPS[builtin_code]} {name}: {weights.size} -> {len(data)} bytes')
+    saved += weights.size - len(data)
+    buffer.data = np.frombuffer(data, dtype=np.uint8)
+    tensor.type = TensorType.UINT8
+    tensor.shape = np.array([len(data)], dtype=np.int32)
+    if tensor.shapeSignature is not None:
+      tensor.shapeSignature = np.array([len(data)], dtype=np.int32)
+
+  model._update_model(model_t)
+  return saved
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Palettize the weights of a quantized .tflite model')
+  parser.add_argument('input', type=Path, help='Input .tflite model')
+  parser.add_argument('output', type=Path, help='Output .tflite model')
+  parser.add_argument('--max-values', type=int, default=64,
+                      help='Maximum number of unique values in a palettized weight tensor (default: 64)')
+  args = parser.parse_args()
+
+  if not 2 <= args.max_values <= 256:
+    parser.error('--max-values must be between 2 and 256')
+
+  model = TfliteModel.load_flatbuffer_file(str(args.input))
+  saved = palettize_model(model, args.max_values)
+  model.save(str(args.output))
+  print(f'Saved {saved} bytes, model size {model.flatbuffer_size} bytes')
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
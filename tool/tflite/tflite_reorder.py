@@ -0,0 +1,318 @@
+#!/usr/bin/env python3
+"""
+Reorder the layers of a .tflite model to minimize the peak arena usage.
+
+The interpreter runs the layers in the order stored in the model. When a
+model has parallel branches, an order finishing one branch before starting
+the next can keep fewer tensors alive at the same time. This tool searches
+the valid orders, where every layer runs after the layers producing its
+inputs, for the one with the smallest peak of live tensor bytes. The search
+is exhaustive over the reachable sets of executed layers, and falls back to
+a greedy order when the graph has too many of them.
+
+Before and after the reordering, the peak live tensor bytes and the arena
+size of a greedy placement of the tensors, largest first like the
+interpreter's memory planner, are reported. Scratch buffers are not included.
+
+Models with an offline memory plan must be reordered before the plan is
+created, see tflite_inplace_plan.py.
+
+Example:
+  python3 tflite_reorder.py model.tflite model_reordered.tflite
+"""
+
+import sys
+import argparse
+from pathlib import Path
+
+from tflite_model import TfliteModel
+from tflite_model.tflite_model import _tflite_schema_fb
+from tensorflow_lite_support.metadata.schema_py_generated import BuiltinOperator
+
+from tflite_inplace_plan import OFFLINE_PLAN_METADATA, TYPE_SIZES, get_builtin_code, tensor_bytes, place_buffers
+
+# Layers accessing resource variables keep their relative order. The
+# variable operators are newer than the bundled schema.
+VAR_HANDLE = 142
+READ_VARIABLE = 143
+ASSIGN_VARIABLE = 144
+ORDERED_OPS = {
+  BuiltinOperator.CALL_ONCE,
+  VAR_HANDLE,
+  READ_VARIABLE,
+  ASSIGN_VARIABLE,
+}
+
+DEFAULT_MAX_STATES = 100000
+
+
+class SearchLimit(Exception):
+  pass
+
+
+def is_constant(model_t, subgraph, index: int) -> bool:
+  buffer = model_t.buffers[subgraph.tensors[index].buffer]
+  return buffer.data is not None and len(buffer.data) > 0
+
+
+def is_planned(model_t, subgraph, index: int) -> bool:
+  '''
+  Tensors placed in the arena by the memory planner.
+  '''
+  tensor = subgraph.tensors[index]
+  return not is_constant(model_t, subgraph, index) and not tensor.isVariable and tensor.type in TYPE_SIZES
+
+
+def check_order(model_t):
+  '''
+  Verify that every layer of the first subgraph runs after the layers
+  producing its inputs. Returns a description of the first violation, or
+  None if the order is valid.
+  '''
+  subgraph = model_t.subgraphs[0]
+  producer = {}
+  for layer_index, operator in enumerate(subgraph.operators):
+    for index in operator.outputs:
+      producer.setdefault(int(index), layer_index)
+  for layer_index, operator in enumerate(subgraph.operators):
+    for index in operator.inputs:
+      index = int(index)
+      if index >= 0 and producer.get(index, -1) > layer_index and not subgraph.tensors[index].isVariable:
+        return f'layer {layer_index} reads tensor {index} before layer {producer[index]} writes it'
+  return None
+
+
+class Graph:
+  '''
+  Dependencies between the layers of the first subgraph, and the size of the
+  tensors planned in the arena.
+  '''
+  def __init__(self, model_t):
+    subgraph = model_t.subgraphs[0]
+    self.n_layers = len(subgraph.operators)
+    self.graph_inputs = set(int(i) for i in subgraph.inputs)
+    self.graph_outputs = set(int(i) for i in subgraph.outputs)
+
+    # Every tensor without constant data is a dependency between the layers
+    # writing and reading it, only the planned tensors count towards the
+    # peak.
+    self.size = {}
+    self.producer = {}
+    self.consumers = {}
+    for layer_index, operator in enumerate(subgraph.operators):
+      for index in operator.outputs:
+        index = int(index)
+        if not is_constant(model_t, subgraph, index):
+          self.producer.setdefault(index, layer_index)
+          if is_planned(model_t, subgraph, index):
+            self.size[index] = tensor_bytes(subgraph.tensors[index])
+      for index in operator.inputs:
+        index = int(index)
+        if index >= 0 and not is_constant(model_t, subgraph, index):
+          self.consumers[index] = self.consumers.get(index, 0) | (1 << layer_index)
+    for index in self.graph_inputs:
+      if is_planned(model_t, subgraph, index):
+        self.size[index] = tensor_bytes(subgraph.tensors[index])
+
+    self.outputs = [[] for _ in range(self.n_layers)]
+    self.preds = [0] * self.n_layers
+    previous_ordered = None
+    previous_user = {}
+    for layer_index, operator in enumerate(subgraph.operators):
+      for index in operator.inputs:
+        index = int(index)
+        if index in self.producer:
+          self.preds[layer_index] |= 1 << self.producer[index]
+      self.outputs[layer_index] = [int(i) for i in operator.outputs if int(i) in self.size]
+      if get_builtin_code(model_t, operator) in ORDERED_OPS:
+        if previous_ordered is not None:
+          self.preds[layer_index] |= 1 << previous_ordered
+        previous_ordered = layer_index
+      # Layers sharing a variable tensor, or writing the same tensor, read
+      # and update it in place and keep their relative order.
+      for index in set(int(i) for i in list(operator.inputs) + list(operator.outputs)):
+        if index < 0 or is_constant(model_t, subgraph, index):
+          continue
+        if subgraph.tensors[index].isVariable or (index in self.producer and index in operator.outputs
+                                                  and self.producer[index] != layer_index):
+          if index in previous_user:
+            self.preds[layer_index] |= 1 << previous_user[index]
+          previous_user[index] = layer_index
+
+  def is_valid_order(self, order):
+    '''
+    Every layer runs exactly once, after all of its predecessors.
+    '''
+    if sorted(order) != list(range(self.n_layers)):
+      return False
+    executed = 0
+    for layer in order:
+      if self.preds[layer] & ~executed:
+        return False
+      executed |= 1 << layer
+    return True
+
+  def is_live(self, index, executed):
+    '''
+    A tensor is live once produced and until all of its users have run.
+    '''
+    produced = index not in self.producer or executed >> self.producer[index] & 1
+    if not produced:
+      return False
+    return index in self.graph_outputs or (self.consumers.get(index, 0) & ~executed) != 0
+
+  def live_bytes(self, executed):
+    return sum(size for index, size in self.size.items() if self.is_live(index, executed))
+
+  def ready(self, executed):
+    return [l for l in range(self.n_layers)
+            if not executed >> l & 1 and (self.preds[l] & ~executed) == 0]
+
+  def peak(self, order):
+    '''
+    Peak live tensor bytes of an order, the inputs and outputs of a layer are
+    live while it runs.
+    '''
+    executed = 0
+    peak = 0
+    for layer in order:
+      peak = max(peak, self.live_bytes(executed) + sum(self.size[i] for i in self.outputs[layer]))
+      executed |= 1 << layer
+    return peak
+
+  def arena(self, order):
+    '''
+    Arena size of a greedy placement of the tensors for an order.
+    '''
+    position = {layer: step for step, layer in enumerate(order)}
+    buffers = []
+    for index, size in self.size.items():
+      first = position[self.producer[index]] if index in self.producer else 0
+      last = first
+      consumers = self.consumers.get(index, 0)
+      for layer in range(self.n_layers):
+        if consumers >> layer & 1:
+          last = max(last, position[layer])
+      if index in self.graph_outputs:
+        last = self.n_layers - 1
+      buffers.append((size, first, last))
+    return place_buffers(buffers)[1]
+
+
+def search_order(graph: Graph, max_states: int):
+  '''
+  Return the order with the smallest peak, searching every reachable set of
+  executed layers. Raises SearchLimit when there are more than max_states.
+  '''
+  full = (1 << graph.n_layers) - 1
+  memo = {full: (0, None)}
+
+  def best(executed):
+    if executed in memo:
+      return memo[executed][0]
+    if len(memo) > max_states:
+      raise SearchLimit()
+    base = graph.live_bytes(executed)
+    result = (float('inf'), None)
+    for layer in graph.ready(executed):
+      running = base + sum(graph.size[i] for i in graph.outputs[layer])
+      if running >= result[0]:
+        continue
+      peak = max(running, best(executed | (1 << layer)))
+      if peak < result[0]:
+        result = (peak, layer)
+    memo[executed] = result
+    return result[0]
+
+  best(0)
+  order = []
+  executed = 0
+  while executed != full:
+    layer = memo[executed][1]
+    order.append(layer)
+    executed |= 1 << layer
+  return order
+
+
+def greedy_order(graph: Graph):
+  '''
+  Run the ready layer with the smallest live bytes while it runs, preferring
+  layers freeing the most bytes.
+  '''
+  order = []
+  executed = 0
+  for _ in range(graph.n_layers):
+    base = graph.live_bytes(executed)
+    def cost(layer):
+      running = base + sum(graph.size[i] for i in graph.outputs[layer])
+      return (running, graph.live_bytes(executed | (1 << layer)))
+    layer = min(graph.ready(executed), key=cost)
+    order.append(layer)
+    executed |= 1 << layer
+  return order
+
+
+def reorder_model(model: TfliteModel, max_states: int = DEFAULT_MAX_STATES):
+  '''
+  Reorder the layers of the model in place. Returns the peak and arena
+  sizes before and after, and whether the search was exhaustive.
+  '''
+  model_t = _tflite_schema_fb.ModelT.InitFromObj(model.flatbuffer_model)
+  graph = Graph(model_t)
+  original = list(range(graph.n_layers))
+
+  sys.setrecursionlimit(max(sys.getrecursionlimit(), 4 * graph.n_layers + 100))
+  exhaustive = True
+  try:
+    order = search_order(graph, max_states)
+  except SearchLimit:
+    exhaustive = False
+    order = greedy_order(graph)
+
+  before = (graph.peak(original), graph.arena(original))
+  after = (graph.peak(order), graph.arena(order))
+  if after[1] > before[1] or (after[1] == before[1] and after[0] >= before[0]):
+    # Keep the stored order unless the arena shrinks.
+    order = original
+    after = before
+
+  if order != original:
+    if not graph.is_valid_order(order):
+      raise ValueError('The layer order is not a valid topological order')
+    subgraph = model_t.subgraphs[0]
+    subgraph.operators = [subgraph.operators[layer] for layer in order]
+    error = check_order(model_t)
+    if error is not None:
+      raise ValueError(f'The layer order is not a valid topological order, {error}')
+    model._update_model(model_t)
+  return before, after, exhaustive
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Reorder the layers of a .tflite model to minimize the peak arena usage')
+  parser.add_argument('input', type=Path, help='Input .tflite model')
+  parser.add_argument('output', type=Path, help='Output .tflite model')
+  parser.add_argument('--max-states', type=int, default=DEFAULT_MAX_STATES,
+                      help=f'Sets of executed layers searched before falling back to a greedy order (default: {DEFAULT_MAX_STATES})')
+  args = parser.parse_args()
+
+  model = TfliteModel.load_flatbuffer_file(str(args.input))
+  if model.get_metadata(OFFLINE_PLAN_METADATA) is not None:
+    print('The model has an offline memory plan, reorder the model before planning it')
+    return 1
+
+  try:
+    before, after, exhaustive = reorder_model(model, args.max_states)
+  except ValueError as e:
+    print(f'{e}, the model is not written')
+    return 1
+  if not exhaustive:
+    print(f'More than {args.max_states} sets of executed layers, using a greedy order')
+  print(f'Peak live tensors: {before[0]} -> {after[0]} bytes')
+  print(f'Arena: {before[1]} -> {after[1]} bytes')
+  model.save(str(args.output))
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())